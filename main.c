@@ -21,29 +21,755 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <string.h>
+#include <pthread.h>
 #include "ssdv.h"
 
+/* Size of the blocks read while decoding */
+#define BLOCK_SIZE (64 * 1024)
+
+/* Size of the buffer the decoded JPEG is written out from */
+#define SINK_SIZE (4 * 1024)
+
+/* Number of packets encoded at a time */
+#define ENCODE_PACKETS (64)
+
+/* Number of image packets sent between each copy of the table packets */
+#define TABLE_REPEAT (128)
+
+/* Number of images decoded at once in multi-image mode */
+#define MAX_SESSIONS (8)
+
+/* The most packets in a group of repair packets */
+#define REPAIR_GROUP (255)
+
+/* An image to encode in batch mode */
+typedef struct {
+	char *filename;
+	uint8_t image_id;
+	uint8_t *packets;
+	int count;
+	char state; /* 0 = waiting, 1 = encoded, -1 = failed */
+} batch_job_t;
+
+typedef struct {
+	batch_job_t *jobs;
+	int count;
+	int next;
+	
+	/* Encoder settings shared by every image */
+	char type;
+	int fec;
+	int repair;
+	char *callsign;
+	int8_t quality;
+	int pkt_length;
+	
+	FILE *fout; /* Write every image here in order, or NULL for a file each */
+	
+	pthread_mutex_t lock;
+	pthread_cond_t done;
+} batch_t;
+
+/* Read the whole of a file into memory */
+uint8_t *read_file(FILE *f, size_t *length)
+{
+	uint8_t *data = NULL;
+	size_t r;
+	
+	*length = 0;
+	do
+	{
+		data = realloc(data, *length + BLOCK_SIZE);
+		r = fread(&data[*length], 1, BLOCK_SIZE, f);
+		*length += r;
+	}
+	while(r > 0);
+	
+	return(data);
+}
+
+/* Send repair packets adding this percentage to the packets of the image,
+ * in groups as large as fit with the most repair packets */
+char set_repair(ssdv_t *ssdv, int percentage)
+{
+	static const int repairs[4] = { 48, 32, 16, 8 };
+	int i, group = 0;
+	
+	for(i = 0; i < 4; i++)
+	{
+		group = repairs[i] * 100 / percentage;
+		if(group + repairs[i] <= 255) break;
+	}
+	
+	if(i == 4) group = 255 - repairs[--i];
+	
+	return(ssdv_enc_set_repair(ssdv, group > 0 ? group : 1, repairs[i]));
+}
+
+/* Number of repair packets sent for a group of 'count' packets. A short
+ * group gets its share of them, the decoder treats the rest as lost */
+int group_repairs(ssdv_t *ssdv, int count)
+{
+	return((count * ssdv->repairs + ssdv->repair_group - 1) / ssdv->repair_group);
+}
+
+/* Number of packets for 'count' image packets and their repair packets */
+int repair_count(ssdv_t *ssdv, int count)
+{
+	if(ssdv->repairs == 0) return(count);
+	return(count + count / ssdv->repair_group * ssdv->repairs + group_repairs(ssdv, count % ssdv->repair_group));
+}
+
+/* Number of packets written by encode_parallel() for 'count' image
+ * packets, with their repair packets and the table packets */
+int output_count(ssdv_t *ssdv, int count)
+{
+	int i, next, step, total = repair_count(ssdv, count);
+	
+	step = (ssdv->repairs ? ssdv->repair_group : TABLE_REPEAT);
+	for(i = next = 0; i < count; i += step)
+	{
+		if(i < next) continue;
+		total += ssdv_enc_table_packets(ssdv);
+		next = i + TABLE_REPEAT;
+	}
+	
+	return(total);
+}
+
+/* Copy image packets to 'out' with each group followed by its repair
+ * packets, returns the number of packets in 'out' */
+int add_repairs(ssdv_t *ssdv, uint8_t *packets, int count, uint8_t *out)
+{
+	uint8_t *repair;
+	int i, n, r, total = 0;
+	
+	for(i = 0; i < count; i += n)
+	{
+		n = count - i;
+		if(ssdv->repairs && n > ssdv->repair_group) n = ssdv->repair_group;
+		
+		memcpy(&out[ssdv->pkt_size * total], &packets[ssdv->pkt_size * i], ssdv->pkt_size * n);
+		total += n;
+		
+		if(ssdv->repairs == 0) continue;
+		
+		/* Only the first of the repair packets of a short group are
+		 * sent, 'out' has no room for the rest */
+		r = group_repairs(ssdv, n);
+		repair = (r < ssdv->repairs ? malloc(ssdv->pkt_size * ssdv->repairs) : &out[ssdv->pkt_size * total]);
+		
+		ssdv_enc_repair_packets(ssdv, &packets[ssdv->pkt_size * i], n, repair);
+		
+		if(repair != &out[ssdv->pkt_size * total])
+		{
+			memcpy(&out[ssdv->pkt_size * total], repair, ssdv->pkt_size * r);
+			free(repair);
+		}
+		
+		total += r;
+	}
+	
+	return(total);
+}
+
+/* Give the decoder, or each image of the demultiplexer, a buffer to
+ * hold 'window' packets in order and one for repairing 'group' packets */
+void set_repair_buffers(ssdv_t *ssdv, ssdv_demux_t *demux, int group, int window, uint8_t **reorder, uint8_t **repairs)
+{
+	int n = (demux ? MAX_SESSIONS : 1);
+	size_t reorder_length = ssdv->pkt_size * window * n;
+	size_t repair_length = ssdv->pkt_size * (SSDV_REPAIR_MAX + group) * n;
+	
+	*reorder = malloc(reorder_length);
+	*repairs = malloc(repair_length);
+	
+	if(demux)
+	{
+		ssdv_demux_set_reorder_buffer(demux, *reorder, reorder_length);
+		ssdv_demux_set_repair_buffer(demux, *repairs, repair_length);
+	}
+	else
+	{
+		ssdv_dec_set_reorder_buffer(ssdv, *reorder, reorder_length);
+		ssdv_dec_set_repair_buffer(ssdv, *repairs, repair_length);
+	}
+}
+
+/* Encode one image from a batch into memory */
+char batch_encode(batch_t *b, batch_job_t *job, ssdv_t *ssdv)
+{
+	ssdv_huff_tables_t huff;
+	uint8_t *jpeg, *packets;
+	size_t jpeg_length;
+	int max, n;
+	char c;
+	FILE *f;
+	
+	f = fopen(job->filename, "rb");
+	if(!f)
+	{
+		fprintf(stderr, "Error opening '%s' for input:\n", job->filename);
+		perror("fopen");
+		return(SSDV_ERROR);
+	}
+	
+	jpeg = read_file(f, &jpeg_length);
+	fclose(f);
+	
+	if(ssdv_enc_init(ssdv, b->type, b->callsign, job->image_id, b->quality, b->pkt_length) != SSDV_OK ||
+	   (b->fec && ssdv_enc_set_fec(ssdv, b->fec) != SSDV_OK) ||
+	   (b->repair && set_repair(ssdv, b->repair) != SSDV_OK))
+	{
+		free(jpeg);
+		return(SSDV_ERROR);
+	}
+	
+	ssdv_enc_set_huff_tables(ssdv, &huff);
+	
+	/* Grow the packet array until the whole image fits */
+	max = ENCODE_PACKETS;
+	job->packets = malloc(b->pkt_length * max);
+	c = ssdv_enc_image(ssdv, jpeg, jpeg_length, job->packets, max, &job->count);
+	
+	while(c == SSDV_BUFFER_FULL)
+	{
+		max *= 2;
+		job->packets = realloc(job->packets, b->pkt_length * max);
+		c = ssdv_enc_image(ssdv, NULL, 0, &job->packets[b->pkt_length * job->count], max - job->count, &n);
+		job->count += n;
+	}
+	
+	free(jpeg);
+	
+	if(c == SSDV_OK && ssdv->repairs)
+	{
+		packets = malloc(b->pkt_length * repair_count(ssdv, job->count));
+		job->count = add_repairs(ssdv, job->packets, job->count, packets);
+		free(job->packets);
+		job->packets = packets;
+	}
+	
+	if(c != SSDV_OK) fprintf(stderr, "Failed to encode '%s': %i\n", job->filename, c);
+	
+	return(c);
+}
+
+/* Write an encoded image to <file>.bin, replacing any extension */
+char batch_write(batch_t *b, batch_job_t *job)
+{
+	char filename[1024], *ext;
+	FILE *f;
+	
+	snprintf(filename, sizeof(filename) - 4, "%s", job->filename);
+	ext = strrchr(filename, '.');
+	if(ext && !strchr(ext, '/')) *ext = '\0';
+	strcat(filename, ".bin");
+	
+	f = fopen(filename, "wb");
+	if(!f)
+	{
+		fprintf(stderr, "Error opening '%s' for output:\n", filename);
+		perror("fopen");
+		return(SSDV_ERROR);
+	}
+	
+	fwrite(job->packets, b->pkt_length, job->count, f);
+	fclose(f);
+	
+	return(SSDV_OK);
+}
+
+/* Worker thread, encodes images from the batch until none are left */
+void *batch_worker(void *arg)
+{
+	batch_t *b = arg;
+	batch_job_t *job;
+	ssdv_t ssdv;
+	char r;
+	
+	while(1)
+	{
+		pthread_mutex_lock(&b->lock);
+		job = (b->next < b->count ? &b->jobs[b->next++] : NULL);
+		pthread_mutex_unlock(&b->lock);
+		
+		if(!job) break;
+		
+		r = batch_encode(b, job, &ssdv);
+		
+		/* Without a single output file, each image is written here */
+		if(r == SSDV_OK && !b->fout) r = batch_write(b, job);
+		
+		/* Only the images written to the single output file are kept */
+		if(!b->fout || r != SSDV_OK)
+		{
+			free(job->packets);
+			job->packets = NULL;
+		}
+		
+		pthread_mutex_lock(&b->lock);
+		job->state = (r == SSDV_OK ? 1 : -1);
+		pthread_cond_broadcast(&b->done);
+		pthread_mutex_unlock(&b->lock);
+	}
+	
+	return(NULL);
+}
+
+/* Encode a list of images on a pool of threads */
+int batch(batch_t *b, int threads)
+{
+	pthread_t *tid;
+	int i, failed = 0, packets = 0;
+	
+	if(threads > b->count) threads = b->count;
+	
+	pthread_mutex_init(&b->lock, NULL);
+	pthread_cond_init(&b->done, NULL);
+	
+	tid = malloc(sizeof(pthread_t) * threads);
+	for(i = 0; i < threads; i++)
+	{
+		pthread_create(&tid[i], NULL, batch_worker, b);
+	}
+	
+	/* Wait for each image in order, writing it to the output if there is one */
+	for(i = 0; i < b->count; i++)
+	{
+		pthread_mutex_lock(&b->lock);
+		while(b->jobs[i].state == 0) pthread_cond_wait(&b->done, &b->lock);
+		pthread_mutex_unlock(&b->lock);
+		
+		if(b->jobs[i].state < 0)
+		{
+			failed++;
+			continue;
+		}
+		
+		if(b->fout)
+		{
+			fwrite(b->jobs[i].packets, b->pkt_length, b->jobs[i].count, b->fout);
+			free(b->jobs[i].packets);
+		}
+		
+		packets += b->jobs[i].count;
+	}
+	
+	for(i = 0; i < threads; i++)
+	{
+		pthread_join(tid[i], NULL);
+	}
+	
+	free(tid);
+	pthread_cond_destroy(&b->done);
+	pthread_mutex_destroy(&b->lock);
+	
+	fprintf(stderr, "Wrote %i packets from %i images\n", packets, b->count - failed);
+	
+	return(failed ? -1 : 0);
+}
+
+/* The segments of an image being decoded in parallel */
+typedef struct {
+	ssdv_t *ssdv;
+	ssdv_segment_t *segments;
+	int count;
+	int next;
+	pthread_mutex_t lock;
+} segments_t;
+
+/* Worker thread, decodes segments until none are left */
+void *segment_worker(void *arg)
+{
+	segments_t *sg = arg;
+	ssdv_segment_t *seg;
+	
+	while(1)
+	{
+		pthread_mutex_lock(&sg->lock);
+		seg = (sg->next < sg->count ? &sg->segments[sg->next++] : NULL);
+		pthread_mutex_unlock(&sg->lock);
+		
+		if(!seg) break;
+		
+		ssdv_dec_segment(sg->ssdv, seg);
+	}
+	
+	return(NULL);
+}
+
+/* Sort packets by packet ID */
+int packet_cmp(const void *a, const void *b)
+{
+	const uint8_t *pa = a, *pb = b;
+	return(((pa[7] << 8) | pa[8]) - ((pb[7] << 8) | pb[8]));
+}
+
+/* Decode the packets of one image on a pool of threads */
+void decode_parallel(ssdv_t *ssdv, uint8_t *packets, int count, int pkt_length, int threads)
+{
+	segments_t sg;
+	pthread_t *tid;
+	uint8_t *out;
+	size_t length;
+	int i, n;
+	
+	/* Keep only the packets of the first image, in order and once each */
+	for(i = n = 0; i < count; i++)
+	{
+		if(memcmp(&packets[pkt_length * i + 2], &packets[2], 5) != 0) continue;
+		
+		/* The decoder keeps the image's tables itself */
+		if((packets[pkt_length * i + 1] - 0x66) & SSDV_TYPE_TABLES)
+		{
+			ssdv_dec_feed(ssdv, &packets[pkt_length * i]);
+			continue;
+		}
+		
+		/* Repair packets are only used when decoding in order */
+		if((packets[pkt_length * i + 1] - 0x66) & SSDV_TYPE_REPAIR) continue;
+		
+		memmove(&packets[pkt_length * n++], &packets[pkt_length * i], pkt_length);
+	}
+	
+	qsort(packets, n, pkt_length, packet_cmp);
+	
+	for(i = count = 0; i < n; i++)
+	{
+		if(count > 0 && packet_cmp(&packets[pkt_length * i], &packets[pkt_length * (count - 1)]) == 0) continue;
+		memmove(&packets[pkt_length * count++], &packets[pkt_length * i], pkt_length);
+	}
+	
+	/* Split the image up, with room for each segment to double in size */
+	length = (size_t) pkt_length * count * 2 + count * 8;
+	out = malloc(length);
+	sg.segments = malloc(sizeof(ssdv_segment_t) * (count > 0 ? count : 1));
+	sg.ssdv = ssdv;
+	sg.next = 0;
+	
+	if(ssdv_dec_split(ssdv, packets, count, sg.segments, &sg.count, out, length) == SSDV_OK)
+	{
+		if(threads > sg.count) threads = sg.count;
+		
+		pthread_mutex_init(&sg.lock, NULL);
+		tid = malloc(sizeof(pthread_t) * (threads > 0 ? threads : 1));
+		
+		for(i = 0; i < threads; i++)
+		{
+			pthread_create(&tid[i], NULL, segment_worker, &sg);
+		}
+		
+		for(i = 0; i < threads; i++)
+		{
+			pthread_join(tid[i], NULL);
+		}
+		
+		free(tid);
+		pthread_mutex_destroy(&sg.lock);
+		
+		/* Join the segments together into the image */
+		ssdv_dec_stitch(ssdv, sg.segments, sg.count);
+	}
+	
+	free(sg.segments);
+	free(out);
+}
+
+/* Number of MCU rows requantised at a time */
+#define PLAN_ROWS (4)
+
+/* An image being encoded in parallel */
+typedef struct {
+	ssdv_t *ssdv;
+	ssdv_plan_t plan;
+	uint8_t *packets;
+	int next;
+	pthread_mutex_t lock;
+} plan_t;
+
+/* Worker thread, requantises runs of MCU rows until none are left */
+void *plan_row_worker(void *arg)
+{
+	plan_t *pl = arg;
+	int first, count;
+	
+	while(1)
+	{
+		pthread_mutex_lock(&pl->lock);
+		first = pl->next;
+		count = pl->plan.rows - first;
+		if(count > PLAN_ROWS) count = PLAN_ROWS;
+		pl->next += count;
+		pthread_mutex_unlock(&pl->lock);
+		
+		if(count <= 0) break;
+		
+		ssdv_enc_plan_rows(pl->ssdv, &pl->plan, first, count);
+	}
+	
+	return(NULL);
+}
+
+/* Worker thread, encodes runs of packets until none are left */
+void *plan_packet_worker(void *arg)
+{
+	plan_t *pl = arg;
+	int first, count;
+	
+	while(1)
+	{
+		pthread_mutex_lock(&pl->lock);
+		first = pl->next;
+		count = pl->plan.packets - first;
+		if(count > ENCODE_PACKETS) count = ENCODE_PACKETS;
+		pl->next += count;
+		pthread_mutex_unlock(&pl->lock);
+		
+		if(count <= 0) break;
+		
+		ssdv_enc_plan_packets(pl->ssdv, &pl->plan, first, count, &pl->packets[pl->ssdv->pkt_size * first]);
+	}
+	
+	return(NULL);
+}
+
+/* Run a worker on a pool of threads until it is done */
+void plan_run(plan_t *pl, void *(*worker)(void *), int threads)
+{
+	pthread_t *tid;
+	int i;
+	
+	pl->next = 0;
+	tid = malloc(sizeof(pthread_t) * threads);
+	
+	for(i = 0; i < threads; i++)
+	{
+		pthread_create(&tid[i], NULL, worker, pl);
+	}
+	
+	for(i = 0; i < threads; i++)
+	{
+		pthread_join(tid[i], NULL);
+	}
+	
+	free(tid);
+}
+
+/* Encode an image on a pool of threads, returns the number of packets or -1.
+ * With max_packets set, the highest quality level that fits is used. 'tables'
+ * selects the tables the image is sent with, SSDV_TABLES_DHT for its own
+ * huffman tables if smaller and SSDV_TABLES_DQT to keep its DQT tables */
+int encode_parallel(ssdv_t *ssdv, uint8_t *jpeg, size_t jpeg_length, int threads, int max_packets, char tables, FILE *fout)
+{
+	plan_t pl;
+	uint8_t *buf, *table, *out;
+	size_t length;
+	int packets[8], q, i, n, count, step, next;
+	
+	/* Read in the coefficients of the image */
+	length = ssdv_enc_plan_size(ssdv, jpeg, jpeg_length);
+	if(length == 0) return(-1);
+	
+	buf = malloc(length);
+	if(ssdv_enc_plan(ssdv, &pl.plan, buf, length) != SSDV_OK)
+	{
+		free(buf);
+		return(-1);
+	}
+	
+	if(tables & SSDV_TABLES_DQT)
+	{
+		/* The quality level doesn't apply */
+		ssdv_enc_set_source_dqt(ssdv);
+	}
+	else if(max_packets > 0)
+	{
+		ssdv_enc_plan_estimate(ssdv, &pl.plan, packets);
+		
+		/* Count the repair and table packets sent with the image too */
+		for(q = 0; q < 8; q++) packets[q] = output_count(ssdv, packets[q]);
+		
+		for(q = 7; q > 0 && packets[q] > max_packets; q--);
+		if(packets[q] > max_packets)
+		{
+			fprintf(stderr, "Warning: the image needs %i packets at the lowest quality level\n", packets[q]);
+		}
+		
+		fprintf(stderr, "Quality level: %i\n", q);
+		ssdv_enc_set_quality(ssdv, q);
+	}
+	
+	pl.ssdv = ssdv;
+	pthread_mutex_init(&pl.lock, NULL);
+	
+	/* Requantise them, then lay out and encode the packets */
+	plan_run(&pl, plan_row_worker, threads);
+	
+	if(tables & SSDV_TABLES_DHT)
+	{
+		ssdv_enc_plan_optimise(ssdv, &pl.plan, TABLE_REPEAT);
+		if(!(ssdv->tables & SSDV_TABLES_DHT))
+		{
+			fprintf(stderr, "The image is smaller with the standard huffman tables\n");
+		}
+	}
+	else ssdv_enc_plan_layout(ssdv, &pl.plan);
+	
+	pl.packets = malloc(ssdv->pkt_size * pl.plan.packets);
+	plan_run(&pl, plan_packet_worker, threads);
+	
+	pthread_mutex_destroy(&pl.lock);
+	
+	/* The table packets go before the image, and again after every
+	 * TABLE_REPEAT packets so a late start can still use the rest.
+	 * With repair packets they only go between groups */
+	n = ssdv_enc_table_packets(ssdv);
+	table = malloc(ssdv->pkt_size * (n > 0 ? n : 1));
+	for(i = 0; i < n; i++) ssdv_enc_table_packet(ssdv, i, &table[ssdv->pkt_size * i]);
+	
+	step = (ssdv->repairs ? ssdv->repair_group : TABLE_REPEAT);
+	out = malloc(ssdv->pkt_size * repair_count(ssdv, step));
+	
+	for(count = i = next = 0; i < pl.plan.packets; i += step)
+	{
+		if(i >= next)
+		{
+			fwrite(table, ssdv->pkt_size, n, fout);
+			count += n;
+			next = i + TABLE_REPEAT;
+		}
+		
+		q = pl.plan.packets - i;
+		if(q > step) q = step;
+		
+		q = add_repairs(ssdv, &pl.packets[ssdv->pkt_size * i], q, out);
+		fwrite(out, ssdv->pkt_size, q, fout);
+		count += q;
+	}
+	
+	free(out);
+	free(table);
+	free(pl.packets);
+	free(buf);
+	
+	return(count);
+}
+
+/* Write the decoded JPEG to the output file as it is produced */
+void write_jpeg(uint8_t *data, size_t length, void *user)
+{
+	fwrite(data, 1, length, (FILE *) user);
+}
+
+/* The images being decoded in multi-image mode, each streamed to
+ * <prefix><callsign>-<id>.jpg as it is decoded */
+typedef struct {
+	char *prefix;
+	ssdv_session_t *sessions;
+	FILE *files[MAX_SESSIONS];
+	char failed[MAX_SESSIONS];
+} images_t;
+
+/* The file for the image a session is decoding, opened on first use */
+FILE *image_file(images_t *im, ssdv_session_t *ss, char *filename, size_t length)
+{
+	int i = ss - im->sessions;
+	
+	snprintf(filename, length, "%s%s-%d.jpg", im->prefix, ss->callsign_s, ss->image_id);
+	
+	if(im->files[i] || im->failed[i]) return(im->files[i]);
+	
+	im->files[i] = fopen(filename, "wb");
+	if(!im->files[i])
+	{
+		fprintf(stderr, "Error opening '%s' for output:\n", filename);
+		perror("fopen");
+		im->failed[i] = 1;
+	}
+	
+	return(im->files[i]);
+}
+
+/* A piece of an image decoded in multi-image mode */
+void write_chunk(ssdv_session_t *ss, uint8_t *data, size_t length, void *user)
+{
+	char filename[1024];
+	FILE *f;
+	
+	f = image_file((images_t *) user, ss, filename, sizeof(filename));
+	if(f) fwrite(data, 1, length, f);
+}
+
+/* Image decoded in multi-image mode, write out the rest and close it */
+void write_image(ssdv_session_t *ss, uint8_t *jpeg, size_t length, char complete, void *user)
+{
+	images_t *im = (images_t *) user;
+	char filename[1024];
+	FILE *f;
+	int i = ss - im->sessions;
+	
+	f = image_file(im, ss, filename, sizeof(filename));
+	
+	im->files[i] = NULL;
+	im->failed[i] = 0;
+	
+	if(!f) return;
+	
+	fwrite(jpeg, 1, length, f);
+	fclose(f);
+	
+	fprintf(stderr, "Wrote %s%s\n", filename, complete ? "" : " (incomplete)");
+}
+
 void exit_usage()
 {
 	fprintf(stderr,
 		"\n"
-		"Usage: ssdv [-e|-d] [-n] [-t <percentage>] [-c <callsign>] [-i <id>] [-q <level>] [-l <length>] [<in file>] [<out file>]\n"
+		"Usage: ssdv [-e|-d] [-n] [-f <codes>] [-R <percentage>] [-m] [-j <threads>] [-r <packets>] [-t <percentage>] [-c <callsign>] [-i <id>] [-q <level>] [-p <packets>] [-s <bytes>] [-H] [-Q] [-l <length>] [<in file>] [<out file>]\n"
+		"       ssdv -e -b [-a] [-j <threads>] [-o <out file>] [-n] [-f <codes>] [-R <percentage>] [-c <callsign>] [-i <id>] [-q <level>] [-l <length>] <in file> ...\n"
 		"\n"
 		"  -e Encode JPEG to SSDV packets.\n"
 		"  -d Decode SSDV packets to JPEG.\n"
 		"\n"
 		"  -n Encode packets with no FEC.\n"
+		"  -f Encode packets with this many Reed-Solomon codes (8, 16, 32 or 48,\n"
+		"     default 32). Older decoders only accept the default.\n"
+		"  -R Send repair packets, this percentage more than the image packets,\n"
+		"     which the decoder uses to rebuild lost packets. Decoding with -j\n"
+		"     ignores them.\n"
+		"  -m Decode multiple images. Each is written to <out file><callsign>-<id>.jpg\n"
+		"  -j Encode or decode the image on this many threads. Decoding starts once\n"
+		"     all packets are read. In batch mode, the number of images to encode\n"
+		"     at once (default: one per CPU).\n"
+		"  -r Hold up to this many packets to correct their order and repair lost\n"
+		"     ones while decoding, 0 for none. By default packets are held once a\n"
+		"     repair packet is received, for as long as its group needs.\n"
 		"  -t For testing, drops the specified percentage of packets while decoding.\n"
 		"  -c Set the callign. Accepts A-Z 0-9 and space, up to 6 characters.\n"
 		"  -i Set the image ID (0-255).\n"
 		"  -q Set the JPEG quality level (0 to 7, defaults to 4).\n"
-		"  -l Set packet length in bytes (max: 256, default 256).\n"
+		"  -p Use the highest quality level that fits in this many packets.\n"
+		"  -s The same, for this many bytes of packets.\n"
+		"  -H Send the image with huffman tables made for it, if that makes it\n"
+		"     smaller. The tables are sent in their own packets, which older\n"
+		"     decoders ignore and so can't decode the image.\n"
+		"  -Q Send the image with its own quantisation tables, in table packets,\n"
+		"     instead of requantising it to a quality level. Not with -p or -s.\n"
+		"  -l Set packet length in bytes (max: 4096, default 256).\n"
 		"  -v Print data for each packet decoded.\n"
 		"\n"
+		"  -b Batch mode, encode every input file. Each is written to <in file>.bin\n"
+		"     with the extension replaced, unless -o is given. Only the options\n"
+		"     shown for it above apply, -p, -s, -H and -Q are not supported.\n"
+		"  -a Increment the image ID for each file in batch mode.\n"
+		"  -o Write the packets for every image to this file, in the order given.\n"
+		"\n"
 		"Packet Length\n"
 		"\n"
 		"The packet length must be specified for both encoding and decoding if not\n"
-		"the default 256 bytes. Smaller packets will increase overhead.\n"
+		"the default 256 bytes. Smaller packets will increase overhead. Longer\n"
+		"packets are protected by several interleaved Reed-Solomon codewords.\n"
 		"\n");
 	exit(-1);
 }
@@ -55,29 +781,57 @@ int main(int argc, char *argv[])
 	FILE *fout = stdout;
 	char encode = -1;
 	char type = SSDV_TYPE_NORMAL;
+	int fec = 0;
+	int repair = 0;
 	int droptest = 0;
 	int verbose = 0;
+	int multi = 0;
+	int batch_mode = 0;
+	int auto_id = 0;
+	int threads = 0;
+	int max_packets = 0;
+	long max_bytes = 0;
+	char tables = 0;
+	char *batch_out = NULL;
+	batch_t b;
+	int window = -1;
+	char *prefix = "";
 	int errors;
+	int n;
 	char callsign[7];
 	uint8_t image_id = 0;
 	int8_t quality = 4;
 	int pkt_length = SSDV_PKT_SIZE;
 	ssdv_t ssdv;
+	ssdv_huff_tables_t huff, *huffs = NULL;
+	ssdv_demux_t demux;
+	images_t images;
+	ssdv_session_t *sessions = NULL;
 	int skipped;
+	int verrors[SSDV_VALIDATE_PACKETS];
+	int ready = 0, next = 0;
 	
-	uint8_t pkt[SSDV_PKT_SIZE], b[128], *jpeg;
-	size_t jpeg_length;
+	uint8_t *jpeg, *buf, *out, *packet, *reorder = NULL, *repairs = NULL, *packets = NULL;
+	size_t jpeg_length, buf_len, pos, offset, r;
+	int count = 0, max, rs;
 	
 	callsign[0] = '\0';
 	
 	opterr = 0;
-	while((c = getopt(argc, argv, "ednc:i:q:l:t:v")) != -1)
+	while((c = getopt(argc, argv, "ednf:R:mbaj:o:c:i:q:p:s:HQl:r:t:v")) != -1)
 	{
 		switch(c)
 		{
 		case 'e': encode = 1; break;
 		case 'd': encode = 0; break;
 		case 'n': type = SSDV_TYPE_NOFEC; break;
+		case 'f': fec = atoi(optarg); break;
+		case 'R': repair = atoi(optarg); break;
+		case 'm': multi = 1; break;
+		case 'b': batch_mode = 1; break;
+		case 'a': auto_id = 1; break;
+		case 'j': threads = atoi(optarg); break;
+		case 'o': batch_out = optarg; break;
 		case 'c':
 			if(strlen(optarg) > 6)
 			{
@@ -88,7 +842,12 @@ int main(int argc, char *argv[])
 			break;
 		case 'i': image_id = atoi(optarg); break;
 		case 'q': quality = atoi(optarg); break;
+		case 'p': max_packets = atoi(optarg); break;
+		case 's': max_bytes = atol(optarg); break;
+		case 'H': tables |= SSDV_TABLES_DHT; break;
+		case 'Q': tables |= SSDV_TABLES_DQT; break;
 		case 'l': pkt_length = atoi(optarg); break;
+		case 'r': window = atoi(optarg); break;
 		case 't': droptest = atoi(optarg); break;
 		case 'v': verbose = 1; break;
 		case '?': exit_usage();
@@ -96,6 +855,61 @@ int main(int argc, char *argv[])
 	}
 	
 	c = argc - optind;
+	
+	/* With -Q there is no quality level to pick to meet a budget */
+	if((tables & SSDV_TABLES_DQT) && (max_packets > 0 || max_bytes > 0))
+	{
+		fprintf(stderr, "The -Q option can't be combined with -p or -s.\n");
+		return(-1);
+	}
+	
+	if(batch_mode)
+	{
+		if(encode != 1 || c < 1) exit_usage();
+		
+		/* Each image is encoded in one pass, without a plan */
+		if(tables || max_packets > 0 || max_bytes > 0)
+		{
+			fprintf(stderr, "The -p, -s, -H and -Q options can't be used with -b.\n");
+			return(-1);
+		}
+		
+		memset(&b, 0, sizeof(b));
+		b.count = c;
+		b.type = type;
+		b.fec = fec;
+		b.repair = repair;
+		b.callsign = callsign;
+		b.quality = quality;
+		b.pkt_length = pkt_length;
+		
+		b.jobs = calloc(c, sizeof(batch_job_t));
+		for(i = 0; i < c; i++)
+		{
+			b.jobs[i].filename = argv[optind + i];
+			b.jobs[i].image_id = image_id + (auto_id ? i : 0);
+		}
+		
+		if(batch_out)
+		{
+			b.fout = fopen(batch_out, "wb");
+			if(!b.fout)
+			{
+				fprintf(stderr, "Error opening '%s' for output:\n", batch_out);
+				perror("fopen");
+				return(-1);
+			}
+		}
+		
+		if(threads <= 0) threads = sysconf(_SC_NPROCESSORS_ONLN);
+		i = batch(&b, threads > 0 ? threads : 1);
+		
+		if(b.fout) fclose(b.fout);
+		free(b.jobs);
+		
+		return(i);
+	}
+	
 	if(c > 2) exit_usage();
 	
 	for(i = 0; i < c; i++)
@@ -115,6 +929,13 @@ int main(int argc, char *argv[])
 			break;
 		
 		case 1:
+			/* The output is a filename prefix in multi-image mode */
+			if(multi)
+			{
+				prefix = argv[optind + i];
+				break;
+			}
+			
 			fout = fopen(argv[optind + i], "wb");
 			if(!fout)         
 			{                 
@@ -137,33 +958,95 @@ int main(int argc, char *argv[])
 			return(-1);
 		}
 		
-		jpeg_length = 1024 * 1024 * 4;
-		jpeg = malloc(jpeg_length);
-		ssdv_dec_set_buffer(&ssdv, jpeg, jpeg_length);
+		if(multi)
+		{
+			/* Stream each image to its own file */
+			sessions = malloc(sizeof(ssdv_session_t) * MAX_SESSIONS);
+			jpeg = malloc(SINK_SIZE * MAX_SESSIONS);
+			memset(&images, 0, sizeof(images));
+			images.prefix = prefix;
+			images.sessions = sessions;
+			ssdv_demux_init(&demux, sessions, MAX_SESSIONS, jpeg, SINK_SIZE * MAX_SESSIONS, pkt_length, write_image, &images);
+			ssdv_demux_set_sink(&demux, write_chunk);
+			
+			huffs = malloc(sizeof(ssdv_huff_tables_t) * MAX_SESSIONS);
+			ssdv_demux_set_huff_tables(&demux, huffs);
+		}
+		else
+		{
+			/* Stream the image to the output file */
+			jpeg = malloc(SINK_SIZE);
+			ssdv_dec_set_buffer(&ssdv, jpeg, SINK_SIZE);
+			ssdv_dec_set_sink(&ssdv, write_jpeg, fout);
+			ssdv_dec_set_huff_tables(&ssdv, &huff);
+		}
+		
+		/* With -r packets are held from the start, and any group can be
+		 * repaired */
+		if(window > 0)
+		{
+			set_repair_buffers(&ssdv, multi ? &demux : NULL, REPAIR_GROUP, window, &reorder, &repairs);
+		}
+		
+		buf = malloc(BLOCK_SIZE);
+		buf_len = pos = 0;
 		
 		i = 0;
-		while(fread(pkt, pkt_length, 1, fin) > 0)
+		skipped = 0;
+		while(1)
 		{
-			/* Drop % of packets */
-			if(droptest && (rand() / (RAND_MAX / 100) < droptest)) continue;
+			/* Refill the buffer when less than a packet remains */
+			if(buf_len - pos < pkt_length)
+			{
+				memmove(buf, &buf[pos], buf_len - pos);
+				buf_len -= pos;
+				pos = 0;
+				
+				r = fread(&buf[buf_len], 1, BLOCK_SIZE - buf_len, fin);
+				if(r <= 0) break;
+				
+				buf_len += r;
+				continue;
+			}
 			
-			/* Test the packet is valid */
-			skipped = 0;
-			while((c = ssdv_dec_is_packet(pkt, pkt_length, &errors)) != 0)
+			/* Validate the packets that follow together, on the
+			 * chance that they are all in one piece */
+			if(ready == 0)
 			{
-				/* Read 1 byte at a time until a new packet is found */
-				memmove(&pkt[0], &pkt[1], pkt_length - 1);
+				c = (buf_len - pos) / pkt_length;
+				if(c > SSDV_VALIDATE_PACKETS) c = SSDV_VALIDATE_PACKETS;
 				
-				if(fread(&pkt[pkt_length - 1], 1, 1, fin) <= 0)
-				{
-					break;
-				}
+				ready = ssdv_dec_is_packets(&buf[pos], c, pkt_length, verrors);
+				next = 0;
+			}
+			
+			if(ready > 0)
+			{
+				errors = verrors[next++];
+				ready--;
+			}
+			else
+			{
+				/* The packet here has been tested already, skip to
+				 * where the next one could begin */
+				for(offset = 1; pos + offset + pkt_length <= buf_len && ssdv_dec_is_candidate(&buf[pos + offset]) != 0; offset++);
+				skipped += offset;
+				pos += offset;
+				
+				/* Find the next valid packet */
+				c = ssdv_dec_find_packet(&buf[pos], buf_len - pos, pkt_length, &offset, &errors);
+				skipped += offset;
+				pos += offset;
 				
-				skipped++;
+				/* No valid packet in the buffer, read some more */
+				if(c != 0) continue;
 			}
 			
-			/* No valid packet was found before EOF */
-			if(c != 0) break;
+			packet = &buf[pos];
+			pos += pkt_length;
+			
+			/* Drop % of packets */
+			if(droptest && (rand() / (RAND_MAX / 100) < droptest)) continue;
 			
 			if(verbose)
 			{
@@ -174,7 +1057,7 @@ int main(int argc, char *argv[])
 					fprintf(stderr, "Skipped %d bytes.\n", skipped);
 				}
 				
-				ssdv_dec_header(&p, pkt);
+				ssdv_dec_header_n(&p, packet, pkt_length);
 				fprintf(stderr, "Decoded image packet. Callsign: \"%s\", Image ID: %d, Resolution: %dx%d, Packet ID: %d (%d errors corrected)\n"
 				                ">> Type: %d, Quality: %d, EOI: %d, MCU Mode: %d, MCU Offset: %d, MCU ID: %d/%d\n",
 					p.callsign_s,
@@ -193,14 +1076,53 @@ int main(int argc, char *argv[])
 				);
 			}
 			
-			/* Feed it to the decoder */
-			ssdv_dec_feed(&ssdv, pkt);
+			skipped = 0;
+			
+			/* Without -r, packets are only held once a repair packet is
+			 * seen: a lost packet is repaired once the rest of its group
+			 * and the repair packets after it arrive, so hold the packets
+			 * after a gap for that long. Decoding with -j ignores them */
+			if(window < 0 && (threads == 0 || multi) && (n = ssdv_dec_repair_group(packet, &rs)) > 0)
+			{
+				window = n + rs;
+				set_repair_buffers(&ssdv, multi ? &demux : NULL, n, window, &reorder, &repairs);
+			}
+			
+			/* Feed it to the decoder, or keep it to decode later */
+			if(threads > 0 && !multi)
+			{
+				if(count % 256 == 0) packets = realloc(packets, pkt_length * (count + 256));
+				memcpy(&packets[pkt_length * count++], packet, pkt_length);
+			}
+			else if(multi) ssdv_demux_feed(&demux, packet);
+			else ssdv_dec_feed(&ssdv, packet);
 			i++;
 		}
 		
-		ssdv_dec_get_jpeg(&ssdv, &jpeg, &jpeg_length);
-		fwrite(jpeg, 1, jpeg_length, fout);
+		free(buf);
+		
+		if(packets)
+		{
+			decode_parallel(&ssdv, packets, count, pkt_length, threads);
+			free(packets);
+		}
+		
+		if(multi)
+		{
+			/* Write out any incomplete images */
+			ssdv_demux_flush(&demux);
+			free(sessions);
+		}
+		else
+		{
+			/* Finish the image, the sink writes out the remainder */
+			ssdv_dec_get_jpeg(&ssdv, &jpeg, &jpeg_length);
+		}
+		
 		free(jpeg);
+		free(reorder);
+		free(repairs);
+		free(huffs);
 		
 		fprintf(stderr, "Read %i packets\n", i);
 		
@@ -208,42 +1130,75 @@ int main(int argc, char *argv[])
 	
 	case 1: /* Encode */
 		
-		if(ssdv_enc_init(&ssdv, type, callsign, image_id, quality, pkt_length) != SSDV_OK)
+		if(ssdv_enc_init(&ssdv, type, callsign, image_id, quality, pkt_length) != SSDV_OK ||
+		   (fec && ssdv_enc_set_fec(&ssdv, fec) != SSDV_OK) ||
+		   (repair && set_repair(&ssdv, repair) != SSDV_OK))
 		{
 			return(-1);
 		}
 		
-		ssdv_enc_set_buffer(&ssdv, pkt);
+		ssdv_enc_set_huff_tables(&ssdv, &huff);
 		
-		i = 0;
+		/* Read the whole image into memory */
+		jpeg = read_file(fin, &jpeg_length);
 		
-		while(1)
+		if(max_bytes > 0)
 		{
-			while((c = ssdv_enc_get_packet(&ssdv)) == SSDV_FEED_ME)
-			{
-				size_t r = fread(b, 1, 128, fin);
-				
-				if(r <= 0)
-				{
-					fprintf(stderr, "Premature end of file\n");
-					break;
-				}
-				ssdv_enc_feed(&ssdv, b, r);
-			}
-			
-			if(c == SSDV_EOI)
+			max_packets = max_bytes / pkt_length;
+			if(max_packets < 1) max_packets = 1;
+		}
+		
+		if(threads > 0 || max_packets > 0 || tables)
+		{
+			i = encode_parallel(&ssdv, jpeg, jpeg_length, threads > 0 ? threads : 1, max_packets, tables, fout);
+			if(i >= 0)
 			{
-				fprintf(stderr, "ssdv_enc_get_packet said EOI\n");
+				free(jpeg);
+				fprintf(stderr, "Wrote %i packets\n", i);
 				break;
 			}
-			else if(c != SSDV_OK)
+			
+			/* The options that need a plan can't be honoured in sequence */
+			if(max_packets > 0 || tables)
 			{
-				fprintf(stderr, "ssdv_enc_get_packet failed: %i\n", c);
+				fprintf(stderr, "The image can't be planned, which -p, -s, -H and -Q need.\n");
+				free(jpeg);
 				return(-1);
 			}
 			
-			fwrite(pkt, 1, pkt_length, fout);
-			i++;
+			/* Fall back to encoding it in sequence */
+			ssdv_enc_init(&ssdv, type, callsign, image_id, quality, pkt_length);
+			if(fec) ssdv_enc_set_fec(&ssdv, fec);
+			if(repair) set_repair(&ssdv, repair);
+			ssdv_enc_set_huff_tables(&ssdv, &huff);
+		}
+		
+		/* Encode it, writing out each batch of packets. With repair
+		 * packets each batch is a group, followed by its repairs */
+		max = (ssdv.repairs ? ssdv.repair_group : ENCODE_PACKETS);
+		buf = malloc(pkt_length * max);
+		out = malloc(pkt_length * repair_count(&ssdv, max));
+		c = ssdv_enc_image(&ssdv, jpeg, jpeg_length, buf, max, &n);
+		n = add_repairs(&ssdv, buf, n, out);
+		fwrite(out, pkt_length, n, fout);
+		i = n;
+		
+		while(c == SSDV_BUFFER_FULL)
+		{
+			c = ssdv_enc_image(&ssdv, NULL, 0, buf, max, &n);
+			n = add_repairs(&ssdv, buf, n, out);
+			fwrite(out, pkt_length, n, fout);
+			i += n;
+		}
+		
+		free(out);
+		free(buf);
+		free(jpeg);
+		
+		if(c != SSDV_OK)
+		{
+			fprintf(stderr, "ssdv_enc_image failed: %i\n", c);
+			return(-1);
 		}
 		
 		fprintf(stderr, "Wrote %i packets\n", i);
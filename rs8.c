@@ -6,8 +6,17 @@
 */
 
 #include <string.h>
+#include <pthread.h>
 #include "rs8.h"
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define RS8_X86
+#include <immintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__)
+#define RS8_NEON
+#include <arm_neon.h>
+#endif
+
 static const uint8_t ALPHA_TO[] = {
 0x01,0x02,0x04,0x08,0x10,0x20,0x40,0x80,0x87,0x89,0x95,0xAD,0xDD,0x3D,0x7A,0xF4,
 0x6F,0xDE,0x3B,0x76,0xEC,0x5F,0xBE,0xFB,0x71,0xE2,0x43,0x86,0x8B,0x91,0xA5,0xCD,
@@ -46,12 +55,6 @@ static const uint8_t INDEX_OF[] = {
 0x2E,0x4B,0xB9,0x60,0x0F,0xED,0x3E,0xE5,0xF6,0x87,0xA5,0x17,0x3A,0xA3,0x3C,0xB7,
 };
 
-static const uint8_t GENPOLY[] = {
-0x00,0xF9,0x3B,0x42,0x04,0x2B,0x7E,0xFB,0x61,0x1E,0x03,0xD5,0x32,0x42,0xAA,0x05,
-0x18,0x05,0xAA,0x42,0x32,0xD5,0x03,0x1E,0x61,0xFB,0x7E,0x2B,0x04,0x42,0x3B,0xF9,
-0x00,
-};
-
 static inline int mod255(int x)
 {
 	while(x >= 255)
@@ -63,73 +66,1527 @@ static inline int mod255(int x)
 }
 #define MODNN(x) mod255(x)
 
-#define MM     (8)
-#define NN     (255)
-#define NROOTS (32)
-#define FCR    (112)
-#define PRIM   (11)
-#define IPRIM  (116)
+#define MM        (8)
+#define NN        (255)
+#define MAX_ROOTS (48)
+#define PRIM      (11)
+#define IPRIM     (116)
 
 #define MIN(a,b) ((a) < (b) ? (a) : (b))
 #define A0       (NN) /* Special reserved value encoding zero in index form */
 
-/* Portable C version */
-void encode_rs_8(uint8_t *data, uint8_t *parity, int pad)
+/* The generator polynomial multiplied by each value of the low and high
+ * nibbles of the feedback term, in the order the parity register is stored.
+ * The product for any feedback value is the XOR of one row from each table.
+ * There is one pair for each supported number of roots, all generated with
+ * FCR = 128 - NROOTS / 2 so the polynomials are symmetric like CCSDS */
+static const uint8_t GENPOLY8_LO[16][8] = {
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xCE,0xE3,0x8B,0x5A,0x8B,0xE3,0xCE,0x01},
+{0x1B,0x41,0x91,0xB4,0x91,0x41,0x1B,0x02},
+{0xD5,0xA2,0x1A,0xEE,0x1A,0xA2,0xD5,0x03},
+{0x36,0x82,0xA5,0xEF,0xA5,0x82,0x36,0x04},
+{0xF8,0x61,0x2E,0xB5,0x2E,0x61,0xF8,0x05},
+{0x2D,0xC3,0x34,0x5B,0x34,0xC3,0x2D,0x06},
+{0xE3,0x20,0xBF,0x01,0xBF,0x20,0xE3,0x07},
+{0x6C,0x83,0xCD,0x59,0xCD,0x83,0x6C,0x08},
+{0xA2,0x60,0x46,0x03,0x46,0x60,0xA2,0x09},
+{0x77,0xC2,0x5C,0xED,0x5C,0xC2,0x77,0x0A},
+{0xB9,0x21,0xD7,0xB7,0xD7,0x21,0xB9,0x0B},
+{0x5A,0x01,0x68,0xB6,0x68,0x01,0x5A,0x0C},
+{0x94,0xE2,0xE3,0xEC,0xE3,0xE2,0x94,0x0D},
+{0x41,0x40,0xF9,0x02,0xF9,0x40,0x41,0x0E},
+{0x8F,0xA3,0x72,0x58,0x72,0xA3,0x8F,0x0F},
+};
+
+static const uint8_t GENPOLY8_HI[16][8] = {
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xD8,0x81,0x1D,0xB2,0x1D,0x81,0xD8,0x10},
+{0x37,0x85,0x3A,0xE3,0x3A,0x85,0x37,0x20},
+{0xEF,0x04,0x27,0x51,0x27,0x04,0xEF,0x30},
+{0x6E,0x8D,0x74,0x41,0x74,0x8D,0x6E,0x40},
+{0xB6,0x0C,0x69,0xF3,0x69,0x0C,0xB6,0x50},
+{0x59,0x08,0x4E,0xA2,0x4E,0x08,0x59,0x60},
+{0x81,0x89,0x53,0x10,0x53,0x89,0x81,0x70},
+{0xDC,0x9D,0xE8,0x82,0xE8,0x9D,0xDC,0x80},
+{0x04,0x1C,0xF5,0x30,0xF5,0x1C,0x04,0x90},
+{0xEB,0x18,0xD2,0x61,0xD2,0x18,0xEB,0xA0},
+{0x33,0x99,0xCF,0xD3,0xCF,0x99,0x33,0xB0},
+{0xB2,0x10,0x9C,0xC3,0x9C,0x10,0xB2,0xC0},
+{0x6A,0x91,0x81,0x71,0x81,0x91,0x6A,0xD0},
+{0x85,0x95,0xA6,0x20,0xA6,0x95,0x85,0xE0},
+{0x5D,0x14,0xBB,0x92,0xBB,0x14,0x5D,0xF0},
+};
+
+static const uint8_t GENPOLY16_LO[16][16] = {
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xA5,0x69,0x1B,0x9F,0x68,0x98,0x65,0x4A,0x65,0x98,0x68,0x9F,0x1B,0x69,0xA5,0x01},
+{0xCD,0xD2,0x36,0xB9,0xD0,0xB7,0xCA,0x94,0xCA,0xB7,0xD0,0xB9,0x36,0xD2,0xCD,0x02},
+{0x68,0xBB,0x2D,0x26,0xB8,0x2F,0xAF,0xDE,0xAF,0x2F,0xB8,0x26,0x2D,0xBB,0x68,0x03},
+{0x1D,0x23,0x6C,0xF5,0x27,0xE9,0x13,0xAF,0x13,0xE9,0x27,0xF5,0x6C,0x23,0x1D,0x04},
+{0xB8,0x4A,0x77,0x6A,0x4F,0x71,0x76,0xE5,0x76,0x71,0x4F,0x6A,0x77,0x4A,0xB8,0x05},
+{0xD0,0xF1,0x5A,0x4C,0xF7,0x5E,0xD9,0x3B,0xD9,0x5E,0xF7,0x4C,0x5A,0xF1,0xD0,0x06},
+{0x75,0x98,0x41,0xD3,0x9F,0xC6,0xBC,0x71,0xBC,0xC6,0x9F,0xD3,0x41,0x98,0x75,0x07},
+{0x3A,0x46,0xD8,0x6D,0x4E,0x55,0x26,0xD9,0x26,0x55,0x4E,0x6D,0xD8,0x46,0x3A,0x08},
+{0x9F,0x2F,0xC3,0xF2,0x26,0xCD,0x43,0x93,0x43,0xCD,0x26,0xF2,0xC3,0x2F,0x9F,0x09},
+{0xF7,0x94,0xEE,0xD4,0x9E,0xE2,0xEC,0x4D,0xEC,0xE2,0x9E,0xD4,0xEE,0x94,0xF7,0x0A},
+{0x52,0xFD,0xF5,0x4B,0xF6,0x7A,0x89,0x07,0x89,0x7A,0xF6,0x4B,0xF5,0xFD,0x52,0x0B},
+{0x27,0x65,0xB4,0x98,0x69,0xBC,0x35,0x76,0x35,0xBC,0x69,0x98,0xB4,0x65,0x27,0x0C},
+{0x82,0x0C,0xAF,0x07,0x01,0x24,0x50,0x3C,0x50,0x24,0x01,0x07,0xAF,0x0C,0x82,0x0D},
+{0xEA,0xB7,0x82,0x21,0xB9,0x0B,0xFF,0xE2,0xFF,0x0B,0xB9,0x21,0x82,0xB7,0xEA,0x0E},
+{0x4F,0xDE,0x99,0xBE,0xD1,0x93,0x9A,0xA8,0x9A,0x93,0xD1,0xBE,0x99,0xDE,0x4F,0x0F},
+};
+
+static const uint8_t GENPOLY16_HI[16][16] = {
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x74,0x8C,0x37,0xDA,0x9C,0xAA,0x4C,0x35,0x4C,0xAA,0x9C,0xDA,0x37,0x8C,0x74,0x10},
+{0xE8,0x9F,0x6E,0x33,0xBF,0xD3,0x98,0x6A,0x98,0xD3,0xBF,0x33,0x6E,0x9F,0xE8,0x20},
+{0x9C,0x13,0x59,0xE9,0x23,0x79,0xD4,0x5F,0xD4,0x79,0x23,0xE9,0x59,0x13,0x9C,0x30},
+{0x57,0xB9,0xDC,0x66,0xF9,0x21,0xB7,0xD4,0xB7,0x21,0xF9,0x66,0xDC,0xB9,0x57,0x40},
+{0x23,0x35,0xEB,0xBC,0x65,0x8B,0xFB,0xE1,0xFB,0x8B,0x65,0xBC,0xEB,0x35,0x23,0x50},
+{0xBF,0x26,0xB2,0x55,0x46,0xF2,0x2F,0xBE,0x2F,0xF2,0x46,0x55,0xB2,0x26,0xBF,0x60},
+{0xCB,0xAA,0x85,0x8F,0xDA,0x58,0x63,0x8B,0x63,0x58,0xDA,0x8F,0x85,0xAA,0xCB,0x70},
+{0xAE,0xF5,0x3F,0xCC,0x75,0x42,0xE9,0x2F,0xE9,0x42,0x75,0xCC,0x3F,0xF5,0xAE,0x80},
+{0xDA,0x79,0x08,0x16,0xE9,0xE8,0xA5,0x1A,0xA5,0xE8,0xE9,0x16,0x08,0x79,0xDA,0x90},
+{0x46,0x6A,0x51,0xFF,0xCA,0x91,0x71,0x45,0x71,0x91,0xCA,0xFF,0x51,0x6A,0x46,0xA0},
+{0x32,0xE6,0x66,0x25,0x56,0x3B,0x3D,0x70,0x3D,0x3B,0x56,0x25,0x66,0xE6,0x32,0xB0},
+{0xF9,0x4C,0xE3,0xAA,0x8C,0x63,0x5E,0xFB,0x5E,0x63,0x8C,0xAA,0xE3,0x4C,0xF9,0xC0},
+{0x8D,0xC0,0xD4,0x70,0x10,0xC9,0x12,0xCE,0x12,0xC9,0x10,0x70,0xD4,0xC0,0x8D,0xD0},
+{0x11,0xD3,0x8D,0x99,0x33,0xB0,0xC6,0x91,0xC6,0xB0,0x33,0x99,0x8D,0xD3,0x11,0xE0},
+{0x65,0x5F,0xBA,0x43,0xAF,0x1A,0x8A,0xA4,0x8A,0x1A,0xAF,0x43,0xBA,0x5F,0x65,0xF0},
+};
+
+static const uint8_t GENPOLY32_LO[16][32] = {
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x5B,0x7F,0x56,0x10,0x1E,0x0D,0xEB,0x61,0xA5,0x08,0x2A,0x36,0x56,0xAB,0x20,0x71,
+ 0x20,0xAB,0x56,0x36,0x2A,0x08,0xA5,0x61,0xEB,0x0D,0x1E,0x10,0x56,0x7F,0x5B,0x01},
+{0xB6,0xFE,0xAC,0x20,0x3C,0x1A,0x51,0xC2,0xCD,0x10,0x54,0x6C,0xAC,0xD1,0x40,0xE2,
+ 0x40,0xD1,0xAC,0x6C,0x54,0x10,0xCD,0xC2,0x51,0x1A,0x3C,0x20,0xAC,0xFE,0xB6,0x02},
+{0xED,0x81,0xFA,0x30,0x22,0x17,0xBA,0xA3,0x68,0x18,0x7E,0x5A,0xFA,0x7A,0x60,0x93,
+ 0x60,0x7A,0xFA,0x5A,0x7E,0x18,0x68,0xA3,0xBA,0x17,0x22,0x30,0xFA,0x81,0xED,0x03},
+{0xEB,0x7B,0xDF,0x40,0x78,0x34,0xA2,0x03,0x1D,0x20,0xA8,0xD8,0xDF,0x25,0x80,0x43,
+ 0x80,0x25,0xDF,0xD8,0xA8,0x20,0x1D,0x03,0xA2,0x34,0x78,0x40,0xDF,0x7B,0xEB,0x04},
+{0xB0,0x04,0x89,0x50,0x66,0x39,0x49,0x62,0xB8,0x28,0x82,0xEE,0x89,0x8E,0xA0,0x32,
+ 0xA0,0x8E,0x89,0xEE,0x82,0x28,0xB8,0x62,0x49,0x39,0x66,0x50,0x89,0x04,0xB0,0x05},
+{0x5D,0x85,0x73,0x60,0x44,0x2E,0xF3,0xC1,0xD0,0x30,0xFC,0xB4,0x73,0xF4,0xC0,0xA1,
+ 0xC0,0xF4,0x73,0xB4,0xFC,0x30,0xD0,0xC1,0xF3,0x2E,0x44,0x60,0x73,0x85,0x5D,0x06},
+{0x06,0xFA,0x25,0x70,0x5A,0x23,0x18,0xA0,0x75,0x38,0xD6,0x82,0x25,0x5F,0xE0,0xD0,
+ 0xE0,0x5F,0x25,0x82,0xD6,0x38,0x75,0xA0,0x18,0x23,0x5A,0x70,0x25,0xFA,0x06,0x07},
+{0x51,0xF6,0x39,0x80,0xF0,0x68,0xC3,0x06,0x3A,0x40,0xD7,0x37,0x39,0x4A,0x87,0x86,
+ 0x87,0x4A,0x39,0x37,0xD7,0x40,0x3A,0x06,0xC3,0x68,0xF0,0x80,0x39,0xF6,0x51,0x08},
+{0x0A,0x89,0x6F,0x90,0xEE,0x65,0x28,0x67,0x9F,0x48,0xFD,0x01,0x6F,0xE1,0xA7,0xF7,
+ 0xA7,0xE1,0x6F,0x01,0xFD,0x48,0x9F,0x67,0x28,0x65,0xEE,0x90,0x6F,0x89,0x0A,0x09},
+{0xE7,0x08,0x95,0xA0,0xCC,0x72,0x92,0xC4,0xF7,0x50,0x83,0x5B,0x95,0x9B,0xC7,0x64,
+ 0xC7,0x9B,0x95,0x5B,0x83,0x50,0xF7,0xC4,0x92,0x72,0xCC,0xA0,0x95,0x08,0xE7,0x0A},
+{0xBC,0x77,0xC3,0xB0,0xD2,0x7F,0x79,0xA5,0x52,0x58,0xA9,0x6D,0xC3,0x30,0xE7,0x15,
+ 0xE7,0x30,0xC3,0x6D,0xA9,0x58,0x52,0xA5,0x79,0x7F,0xD2,0xB0,0xC3,0x77,0xBC,0x0B},
+{0xBA,0x8D,0xE6,0xC0,0x88,0x5C,0x61,0x05,0x27,0x60,0x7F,0xEF,0xE6,0x6F,0x07,0xC5,
+ 0x07,0x6F,0xE6,0xEF,0x7F,0x60,0x27,0x05,0x61,0x5C,0x88,0xC0,0xE6,0x8D,0xBA,0x0C},
+{0xE1,0xF2,0xB0,0xD0,0x96,0x51,0x8A,0x64,0x82,0x68,0x55,0xD9,0xB0,0xC4,0x27,0xB4,
+ 0x27,0xC4,0xB0,0xD9,0x55,0x68,0x82,0x64,0x8A,0x51,0x96,0xD0,0xB0,0xF2,0xE1,0x0D},
+{0x0C,0x73,0x4A,0xE0,0xB4,0x46,0x30,0xC7,0xEA,0x70,0x2B,0x83,0x4A,0xBE,0x47,0x27,
+ 0x47,0xBE,0x4A,0x83,0x2B,0x70,0xEA,0xC7,0x30,0x46,0xB4,0xE0,0x4A,0x73,0x0C,0x0E},
+{0x57,0x0C,0x1C,0xF0,0xAA,0x4B,0xDB,0xA6,0x4F,0x78,0x01,0xB5,0x1C,0x15,0x67,0x56,
+ 0x67,0x15,0x1C,0xB5,0x01,0x78,0x4F,0xA6,0xDB,0x4B,0xAA,0xF0,0x1C,0x0C,0x57,0x0F},
+};
+
+static const uint8_t GENPOLY32_HI[16][32] = {
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xA2,0x6B,0x72,0x87,0x67,0xD0,0x01,0x0C,0x74,0x80,0x29,0x6E,0x72,0x94,0x89,0x8B,
+ 0x89,0x94,0x72,0x6E,0x29,0x80,0x74,0x0C,0x01,0xD0,0x67,0x87,0x72,0x6B,0xA2,0x10},
+{0xC3,0xD6,0xE4,0x89,0xCE,0x27,0x02,0x18,0xE8,0x87,0x52,0xDC,0xE4,0xAF,0x95,0x91,
+ 0x95,0xAF,0xE4,0xDC,0x52,0x87,0xE8,0x18,0x02,0x27,0xCE,0x89,0xE4,0xD6,0xC3,0x20},
+{0x61,0xBD,0x96,0x0E,0xA9,0xF7,0x03,0x14,0x9C,0x07,0x7B,0xB2,0x96,0x3B,0x1C,0x1A,
+ 0x1C,0x3B,0x96,0xB2,0x7B,0x07,0x9C,0x14,0x03,0xF7,0xA9,0x0E,0x96,0xBD,0x61,0x30},
+{0x01,0x2B,0x4F,0x95,0x1B,0x4E,0x04,0x30,0x57,0x89,0xA4,0x3F,0x4F,0xD9,0xAD,0xA5,
+ 0xAD,0xD9,0x4F,0x3F,0xA4,0x89,0x57,0x30,0x04,0x4E,0x1B,0x95,0x4F,0x2B,0x01,0x40},
+{0xA3,0x40,0x3D,0x12,0x7C,0x9E,0x05,0x3C,0x23,0x09,0x8D,0x51,0x3D,0x4D,0x24,0x2E,
+ 0x24,0x4D,0x3D,0x51,0x8D,0x09,0x23,0x3C,0x05,0x9E,0x7C,0x12,0x3D,0x40,0xA3,0x50},
+{0xC2,0xFD,0xAB,0x1C,0xD5,0x69,0x06,0x28,0xBF,0x0E,0xF6,0xE3,0xAB,0x76,0x38,0x34,
+ 0x38,0x76,0xAB,0xE3,0xF6,0x0E,0xBF,0x28,0x06,0x69,0xD5,0x1C,0xAB,0xFD,0xC2,0x60},
+{0x60,0x96,0xD9,0x9B,0xB2,0xB9,0x07,0x24,0xCB,0x8E,0xDF,0x8D,0xD9,0xE2,0xB1,0xBF,
+ 0xB1,0xE2,0xD9,0x8D,0xDF,0x8E,0xCB,0x24,0x07,0xB9,0xB2,0x9B,0xD9,0x96,0x60,0x70},
+{0x02,0x56,0x9E,0xAD,0x36,0x9C,0x08,0x60,0xAE,0x95,0xCF,0x7E,0x9E,0x35,0xDD,0xCD,
+ 0xDD,0x35,0x9E,0x7E,0xCF,0x95,0xAE,0x60,0x08,0x9C,0x36,0xAD,0x9E,0x56,0x02,0x80},
+{0xA0,0x3D,0xEC,0x2A,0x51,0x4C,0x09,0x6C,0xDA,0x15,0xE6,0x10,0xEC,0xA1,0x54,0x46,
+ 0x54,0xA1,0xEC,0x10,0xE6,0x15,0xDA,0x6C,0x09,0x4C,0x51,0x2A,0xEC,0x3D,0xA0,0x90},
+{0xC1,0x80,0x7A,0x24,0xF8,0xBB,0x0A,0x78,0x46,0x12,0x9D,0xA2,0x7A,0x9A,0x48,0x5C,
+ 0x48,0x9A,0x7A,0xA2,0x9D,0x12,0x46,0x78,0x0A,0xBB,0xF8,0x24,0x7A,0x80,0xC1,0xA0},
+{0x63,0xEB,0x08,0xA3,0x9F,0x6B,0x0B,0x74,0x32,0x92,0xB4,0xCC,0x08,0x0E,0xC1,0xD7,
+ 0xC1,0x0E,0x08,0xCC,0xB4,0x92,0x32,0x74,0x0B,0x6B,0x9F,0xA3,0x08,0xEB,0x63,0xB0},
+{0x03,0x7D,0xD1,0x38,0x2D,0xD2,0x0C,0x50,0xF9,0x1C,0x6B,0x41,0xD1,0xEC,0x70,0x68,
+ 0x70,0xEC,0xD1,0x41,0x6B,0x1C,0xF9,0x50,0x0C,0xD2,0x2D,0x38,0xD1,0x7D,0x03,0xC0},
+{0xA1,0x16,0xA3,0xBF,0x4A,0x02,0x0D,0x5C,0x8D,0x9C,0x42,0x2F,0xA3,0x78,0xF9,0xE3,
+ 0xF9,0x78,0xA3,0x2F,0x42,0x9C,0x8D,0x5C,0x0D,0x02,0x4A,0xBF,0xA3,0x16,0xA1,0xD0},
+{0xC0,0xAB,0x35,0xB1,0xE3,0xF5,0x0E,0x48,0x11,0x9B,0x39,0x9D,0x35,0x43,0xE5,0xF9,
+ 0xE5,0x43,0x35,0x9D,0x39,0x9B,0x11,0x48,0x0E,0xF5,0xE3,0xB1,0x35,0xAB,0xC0,0xE0},
+{0x62,0xC0,0x47,0x36,0x84,0x25,0x0F,0x44,0x65,0x1B,0x10,0xF3,0x47,0xD7,0x6C,0x72,
+ 0x6C,0xD7,0x47,0xF3,0x10,0x1B,0x65,0x44,0x0F,0x25,0x84,0x36,0x47,0xC0,0x62,0xF0},
+};
+
+static const uint8_t GENPOLY48_LO[16][48] = {
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x8F,0x5B,0x10,0xB1,0x13,0x60,0xE4,0x3E,0xC4,0xB6,0x88,0xA2,0xEA,0x62,0xE7,0x24,
+ 0x59,0xBC,0xAD,0x04,0xDC,0xD2,0x9C,0xC7,0x9C,0xD2,0xDC,0x04,0xAD,0xBC,0x59,0x24,
+ 0xE7,0x62,0xEA,0xA2,0x88,0xB6,0xC4,0x3E,0xE4,0x60,0x13,0xB1,0x10,0x5B,0x8F,0x01},
+{0x99,0xB6,0x20,0xE5,0x26,0xC0,0x4F,0x7C,0x0F,0xEB,0x97,0xC3,0x53,0xC4,0x49,0x48,
+ 0xB2,0xFF,0xDD,0x08,0x3F,0x23,0xBF,0x09,0xBF,0x23,0x3F,0x08,0xDD,0xFF,0xB2,0x48,
+ 0x49,0xC4,0x53,0xC3,0x97,0xEB,0x0F,0x7C,0x4F,0xC0,0x26,0xE5,0x20,0xB6,0x99,0x02},
+{0x16,0xED,0x30,0x54,0x35,0xA0,0xAB,0x42,0xCB,0x5D,0x1F,0x61,0xB9,0xA6,0xAE,0x6C,
+ 0xEB,0x43,0x70,0x0C,0xE3,0xF1,0x23,0xCE,0x23,0xF1,0xE3,0x0C,0x70,0x43,0xEB,0x6C,
+ 0xAE,0xA6,0xB9,0x61,0x1F,0x5D,0xCB,0x42,0xAB,0xA0,0x35,0x54,0x30,0xED,0x16,0x03},
+{0xB5,0xEB,0x40,0x4D,0x4C,0x07,0x9E,0xF8,0x1E,0x51,0xA9,0x01,0xA6,0x0F,0x92,0x90,
+ 0xE3,0x79,0x3D,0x10,0x7E,0x46,0xF9,0x12,0xF9,0x46,0x7E,0x10,0x3D,0x79,0xE3,0x90,
+ 0x92,0x0F,0xA6,0x01,0xA9,0x51,0x1E,0xF8,0x9E,0x07,0x4C,0x4D,0x40,0xEB,0xB5,0x04},
+{0x3A,0xB0,0x50,0xFC,0x5F,0x67,0x7A,0xC6,0xDA,0xE7,0x21,0xA3,0x4C,0x6D,0x75,0xB4,
+ 0xBA,0xC5,0x90,0x14,0xA2,0x94,0x65,0xD5,0x65,0x94,0xA2,0x14,0x90,0xC5,0xBA,0xB4,
+ 0x75,0x6D,0x4C,0xA3,0x21,0xE7,0xDA,0xC6,0x7A,0x67,0x5F,0xFC,0x50,0xB0,0x3A,0x05},
+{0x2C,0x5D,0x60,0xA8,0x6A,0xC7,0xD1,0x84,0x11,0xBA,0x3E,0xC2,0xF5,0xCB,0xDB,0xD8,
+ 0x51,0x86,0xE0,0x18,0x41,0x65,0x46,0x1B,0x46,0x65,0x41,0x18,0xE0,0x86,0x51,0xD8,
+ 0xDB,0xCB,0xF5,0xC2,0x3E,0xBA,0x11,0x84,0xD1,0xC7,0x6A,0xA8,0x60,0x5D,0x2C,0x06},
+{0xA3,0x06,0x70,0x19,0x79,0xA7,0x35,0xBA,0xD5,0x0C,0xB6,0x60,0x1F,0xA9,0x3C,0xFC,
+ 0x08,0x3A,0x4D,0x1C,0x9D,0xB7,0xDA,0xDC,0xDA,0xB7,0x9D,0x1C,0x4D,0x3A,0x08,0xFC,
+ 0x3C,0xA9,0x1F,0x60,0xB6,0x0C,0xD5,0xBA,0x35,0xA7,0x79,0x19,0x70,0x06,0xA3,0x07},
+{0xED,0x51,0x80,0x9A,0x98,0x0E,0xBB,0x77,0x3C,0xA2,0xD5,0x02,0xCB,0x1E,0xA3,0xA7,
+ 0x41,0xF2,0x7A,0x20,0xFC,0x8C,0x75,0x24,0x75,0x8C,0xFC,0x20,0x7A,0xF2,0x41,0xA7,
+ 0xA3,0x1E,0xCB,0x02,0xD5,0xA2,0x3C,0x77,0xBB,0x0E,0x98,0x9A,0x80,0x51,0xED,0x08},
+{0x62,0x0A,0x90,0x2B,0x8B,0x6E,0x5F,0x49,0xF8,0x14,0x5D,0xA0,0x21,0x7C,0x44,0x83,
+ 0x18,0x4E,0xD7,0x24,0x20,0x5E,0xE9,0xE3,0xE9,0x5E,0x20,0x24,0xD7,0x4E,0x18,0x83,
+ 0x44,0x7C,0x21,0xA0,0x5D,0x14,0xF8,0x49,0x5F,0x6E,0x8B,0x2B,0x90,0x0A,0x62,0x09},
+{0x74,0xE7,0xA0,0x7F,0xBE,0xCE,0xF4,0x0B,0x33,0x49,0x42,0xC1,0x98,0xDA,0xEA,0xEF,
+ 0xF3,0x0D,0xA7,0x28,0xC3,0xAF,0xCA,0x2D,0xCA,0xAF,0xC3,0x28,0xA7,0x0D,0xF3,0xEF,
+ 0xEA,0xDA,0x98,0xC1,0x42,0x49,0x33,0x0B,0xF4,0xCE,0xBE,0x7F,0xA0,0xE7,0x74,0x0A},
+{0xFB,0xBC,0xB0,0xCE,0xAD,0xAE,0x10,0x35,0xF7,0xFF,0xCA,0x63,0x72,0xB8,0x0D,0xCB,
+ 0xAA,0xB1,0x0A,0x2C,0x1F,0x7D,0x56,0xEA,0x56,0x7D,0x1F,0x2C,0x0A,0xB1,0xAA,0xCB,
+ 0x0D,0xB8,0x72,0x63,0xCA,0xFF,0xF7,0x35,0x10,0xAE,0xAD,0xCE,0xB0,0xBC,0xFB,0x0B},
+{0x58,0xBA,0xC0,0xD7,0xD4,0x09,0x25,0x8F,0x22,0xF3,0x7C,0x03,0x6D,0x11,0x31,0x37,
+ 0xA2,0x8B,0x47,0x30,0x82,0xCA,0x8C,0x36,0x8C,0xCA,0x82,0x30,0x47,0x8B,0xA2,0x37,
+ 0x31,0x11,0x6D,0x03,0x7C,0xF3,0x22,0x8F,0x25,0x09,0xD4,0xD7,0xC0,0xBA,0x58,0x0C},
+{0xD7,0xE1,0xD0,0x66,0xC7,0x69,0xC1,0xB1,0xE6,0x45,0xF4,0xA1,0x87,0x73,0xD6,0x13,
+ 0xFB,0x37,0xEA,0x34,0x5E,0x18,0x10,0xF1,0x10,0x18,0x5E,0x34,0xEA,0x37,0xFB,0x13,
+ 0xD6,0x73,0x87,0xA1,0xF4,0x45,0xE6,0xB1,0xC1,0x69,0xC7,0x66,0xD0,0xE1,0xD7,0x0D},
+{0xC1,0x0C,0xE0,0x32,0xF2,0xC9,0x6A,0xF3,0x2D,0x18,0xEB,0xC0,0x3E,0xD5,0x78,0x7F,
+ 0x10,0x74,0x9A,0x38,0xBD,0xE9,0x33,0x3F,0x33,0xE9,0xBD,0x38,0x9A,0x74,0x10,0x7F,
+ 0x78,0xD5,0x3E,0xC0,0xEB,0x18,0x2D,0xF3,0x6A,0xC9,0xF2,0x32,0xE0,0x0C,0xC1,0x0E},
+{0x4E,0x57,0xF0,0x83,0xE1,0xA9,0x8E,0xCD,0xE9,0xAE,0x63,0x62,0xD4,0xB7,0x9F,0x5B,
+ 0x49,0xC8,0x37,0x3C,0x61,0x3B,0xAF,0xF8,0xAF,0x3B,0x61,0x3C,0x37,0xC8,0x49,0x5B,
+ 0x9F,0xB7,0xD4,0x62,0x63,0xAE,0xE9,0xCD,0x8E,0xA9,0xE1,0x83,0xF0,0x57,0x4E,0x0F},
+};
+
+static const uint8_t GENPOLY48_HI[16][48] = {
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x5D,0xA2,0x87,0xB3,0xB7,0x1C,0xF1,0xEE,0x78,0xC3,0x2D,0x04,0x11,0x3C,0xC1,0xC9,
+ 0x82,0x63,0xF4,0x40,0x7F,0x9F,0xEA,0x48,0xEA,0x9F,0x7F,0x40,0xF4,0x63,0x82,0xC9,
+ 0xC1,0x3C,0x11,0x04,0x2D,0xC3,0x78,0xEE,0xF1,0x1C,0xB7,0xB3,0x87,0xA2,0x5D,0x10},
+{0xBA,0xC3,0x89,0xE1,0xE9,0x38,0x65,0x5B,0xF0,0x01,0x5A,0x08,0x22,0x78,0x05,0x15,
+ 0x83,0xC6,0x6F,0x80,0xFE,0xB9,0x53,0x90,0x53,0xB9,0xFE,0x80,0x6F,0xC6,0x83,0x15,
+ 0x05,0x78,0x22,0x08,0x5A,0x01,0xF0,0x5B,0x65,0x38,0xE9,0xE1,0x89,0xC3,0xBA,0x20},
+{0xE7,0x61,0x0E,0x52,0x5E,0x24,0x94,0xB5,0x88,0xC2,0x77,0x0C,0x33,0x44,0xC4,0xDC,
+ 0x01,0xA5,0x9B,0xC0,0x81,0x26,0xB9,0xD8,0xB9,0x26,0x81,0xC0,0x9B,0xA5,0x01,0xDC,
+ 0xC4,0x44,0x33,0x0C,0x77,0xC2,0x88,0xB5,0x94,0x24,0x5E,0x52,0x0E,0x61,0xE7,0x30},
+{0xF3,0x01,0x95,0x45,0x55,0x70,0xCA,0xB6,0x67,0x02,0xB4,0x10,0x44,0xF0,0x0A,0x2A,
+ 0x81,0x0B,0xDE,0x87,0x7B,0xF5,0xA6,0xA7,0xA6,0xF5,0x7B,0x87,0xDE,0x0B,0x81,0x2A,
+ 0x0A,0xF0,0x44,0x10,0xB4,0x02,0x67,0xB6,0xCA,0x70,0x55,0x45,0x95,0x01,0xF3,0x40},
+{0xAE,0xA3,0x12,0xF6,0xE2,0x6C,0x3B,0x58,0x1F,0xC1,0x99,0x14,0x55,0xCC,0xCB,0xE3,
+ 0x03,0x68,0x2A,0xC7,0x04,0x6A,0x4C,0xEF,0x4C,0x6A,0x04,0xC7,0x2A,0x68,0x03,0xE3,
+ 0xCB,0xCC,0x55,0x14,0x99,0xC1,0x1F,0x58,0x3B,0x6C,0xE2,0xF6,0x12,0xA3,0xAE,0x50},
+{0x49,0xC2,0x1C,0xA4,0xBC,0x48,0xAF,0xED,0x97,0x03,0xEE,0x18,0x66,0x88,0x0F,0x3F,
+ 0x02,0xCD,0xB1,0x07,0x85,0x4C,0xF5,0x37,0xF5,0x4C,0x85,0x07,0xB1,0xCD,0x02,0x3F,
+ 0x0F,0x88,0x66,0x18,0xEE,0x03,0x97,0xED,0xAF,0x48,0xBC,0xA4,0x1C,0xC2,0x49,0x60},
+{0x14,0x60,0x9B,0x17,0x0B,0x54,0x5E,0x03,0xEF,0xC0,0xC3,0x1C,0x77,0xB4,0xCE,0xF6,
+ 0x80,0xAE,0x45,0x47,0xFA,0xD3,0x1F,0x7F,0x1F,0xD3,0xFA,0x47,0x45,0xAE,0x80,0xF6,
+ 0xCE,0xB4,0x77,0x1C,0xC3,0xC0,0xEF,0x03,0x5E,0x54,0x0B,0x17,0x9B,0x60,0x14,0x70},
+{0x61,0x02,0xAD,0x8A,0xAA,0xE0,0x13,0xEB,0xCE,0x04,0xEF,0x20,0x88,0x67,0x14,0x54,
+ 0x85,0x16,0x3B,0x89,0xF6,0x6D,0xCB,0xC9,0xCB,0x6D,0xF6,0x89,0x3B,0x16,0x85,0x54,
+ 0x14,0x67,0x88,0x20,0xEF,0x04,0xCE,0xEB,0x13,0xE0,0xAA,0x8A,0xAD,0x02,0x61,0x80},
+{0x3C,0xA0,0x2A,0x39,0x1D,0xFC,0xE2,0x05,0xB6,0xC7,0xC2,0x24,0x99,0x5B,0xD5,0x9D,
+ 0x07,0x75,0xCF,0xC9,0x89,0xF2,0x21,0x81,0x21,0xF2,0x89,0xC9,0xCF,0x75,0x07,0x9D,
+ 0xD5,0x5B,0x99,0x24,0xC2,0xC7,0xB6,0x05,0xE2,0xFC,0x1D,0x39,0x2A,0xA0,0x3C,0x90},
+{0xDB,0xC1,0x24,0x6B,0x43,0xD8,0x76,0xB0,0x3E,0x05,0xB5,0x28,0xAA,0x1F,0x11,0x41,
+ 0x06,0xD0,0x54,0x09,0x08,0xD4,0x98,0x59,0x98,0xD4,0x08,0x09,0x54,0xD0,0x06,0x41,
+ 0x11,0x1F,0xAA,0x28,0xB5,0x05,0x3E,0xB0,0x76,0xD8,0x43,0x6B,0x24,0xC1,0xDB,0xA0},
+{0x86,0x63,0xA3,0xD8,0xF4,0xC4,0x87,0x5E,0x46,0xC6,0x98,0x2C,0xBB,0x23,0xD0,0x88,
+ 0x84,0xB3,0xA0,0x49,0x77,0x4B,0x72,0x11,0x72,0x4B,0x77,0x49,0xA0,0xB3,0x84,0x88,
+ 0xD0,0x23,0xBB,0x2C,0x98,0xC6,0x46,0x5E,0x87,0xC4,0xF4,0xD8,0xA3,0x63,0x86,0xB0},
+{0x92,0x03,0x38,0xCF,0xFF,0x90,0xD9,0x5D,0xA9,0x06,0x5B,0x30,0xCC,0x97,0x1E,0x7E,
+ 0x04,0x1D,0xE5,0x0E,0x8D,0x98,0x6D,0x6E,0x6D,0x98,0x8D,0x0E,0xE5,0x1D,0x04,0x7E,
+ 0x1E,0x97,0xCC,0x30,0x5B,0x06,0xA9,0x5D,0xD9,0x90,0xFF,0xCF,0x38,0x03,0x92,0xC0},
+{0xCF,0xA1,0xBF,0x7C,0x48,0x8C,0x28,0xB3,0xD1,0xC5,0x76,0x34,0xDD,0xAB,0xDF,0xB7,
+ 0x86,0x7E,0x11,0x4E,0xF2,0x07,0x87,0x26,0x87,0x07,0xF2,0x4E,0x11,0x7E,0x86,0xB7,
+ 0xDF,0xAB,0xDD,0x34,0x76,0xC5,0xD1,0xB3,0x28,0x8C,0x48,0x7C,0xBF,0xA1,0xCF,0xD0},
+{0x28,0xC0,0xB1,0x2E,0x16,0xA8,0xBC,0x06,0x59,0x07,0x01,0x38,0xEE,0xEF,0x1B,0x6B,
+ 0x87,0xDB,0x8A,0x8E,0x73,0x21,0x3E,0xFE,0x3E,0x21,0x73,0x8E,0x8A,0xDB,0x87,0x6B,
+ 0x1B,0xEF,0xEE,0x38,0x01,0x07,0x59,0x06,0xBC,0xA8,0x16,0x2E,0xB1,0xC0,0x28,0xE0},
+{0x75,0x62,0x36,0x9D,0xA1,0xB4,0x4D,0xE8,0x21,0xC4,0x2C,0x3C,0xFF,0xD3,0xDA,0xA2,
+ 0x05,0xB8,0x7E,0xCE,0x0C,0xBE,0xD4,0xB6,0xD4,0xBE,0x0C,0xCE,0x7E,0xB8,0x05,0xA2,
+ 0xDA,0xD3,0xFF,0x3C,0x2C,0xC4,0x21,0xE8,0x4D,0xB4,0xA1,0x9D,0x36,0x62,0x75,0xF0},
+};
+
+
+/* The product of every value with each value of the low and high nibbles */
+static const uint8_t MUL_LO[256][16] = {
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0A,0x0B,0x0C,0x0D,0x0E,0x0F},
+{0x00,0x02,0x04,0x06,0x08,0x0A,0x0C,0x0E,0x10,0x12,0x14,0x16,0x18,0x1A,0x1C,0x1E},
+{0x00,0x03,0x06,0x05,0x0C,0x0F,0x0A,0x09,0x18,0x1B,0x1E,0x1D,0x14,0x17,0x12,0x11},
+{0x00,0x04,0x08,0x0C,0x10,0x14,0x18,0x1C,0x20,0x24,0x28,0x2C,0x30,0x34,0x38,0x3C},
+{0x00,0x05,0x0A,0x0F,0x14,0x11,0x1E,0x1B,0x28,0x2D,0x22,0x27,0x3C,0x39,0x36,0x33},
+{0x00,0x06,0x0C,0x0A,0x18,0x1E,0x14,0x12,0x30,0x36,0x3C,0x3A,0x28,0x2E,0x24,0x22},
+{0x00,0x07,0x0E,0x09,0x1C,0x1B,0x12,0x15,0x38,0x3F,0x36,0x31,0x24,0x23,0x2A,0x2D},
+{0x00,0x08,0x10,0x18,0x20,0x28,0x30,0x38,0x40,0x48,0x50,0x58,0x60,0x68,0x70,0x78},
+{0x00,0x09,0x12,0x1B,0x24,0x2D,0x36,0x3F,0x48,0x41,0x5A,0x53,0x6C,0x65,0x7E,0x77},
+{0x00,0x0A,0x14,0x1E,0x28,0x22,0x3C,0x36,0x50,0x5A,0x44,0x4E,0x78,0x72,0x6C,0x66},
+{0x00,0x0B,0x16,0x1D,0x2C,0x27,0x3A,0x31,0x58,0x53,0x4E,0x45,0x74,0x7F,0x62,0x69},
+{0x00,0x0C,0x18,0x14,0x30,0x3C,0x28,0x24,0x60,0x6C,0x78,0x74,0x50,0x5C,0x48,0x44},
+{0x00,0x0D,0x1A,0x17,0x34,0x39,0x2E,0x23,0x68,0x65,0x72,0x7F,0x5C,0x51,0x46,0x4B},
+{0x00,0x0E,0x1C,0x12,0x38,0x36,0x24,0x2A,0x70,0x7E,0x6C,0x62,0x48,0x46,0x54,0x5A},
+{0x00,0x0F,0x1E,0x11,0x3C,0x33,0x22,0x2D,0x78,0x77,0x66,0x69,0x44,0x4B,0x5A,0x55},
+{0x00,0x10,0x20,0x30,0x40,0x50,0x60,0x70,0x80,0x90,0xA0,0xB0,0xC0,0xD0,0xE0,0xF0},
+{0x00,0x11,0x22,0x33,0x44,0x55,0x66,0x77,0x88,0x99,0xAA,0xBB,0xCC,0xDD,0xEE,0xFF},
+{0x00,0x12,0x24,0x36,0x48,0x5A,0x6C,0x7E,0x90,0x82,0xB4,0xA6,0xD8,0xCA,0xFC,0xEE},
+{0x00,0x13,0x26,0x35,0x4C,0x5F,0x6A,0x79,0x98,0x8B,0xBE,0xAD,0xD4,0xC7,0xF2,0xE1},
+{0x00,0x14,0x28,0x3C,0x50,0x44,0x78,0x6C,0xA0,0xB4,0x88,0x9C,0xF0,0xE4,0xD8,0xCC},
+{0x00,0x15,0x2A,0x3F,0x54,0x41,0x7E,0x6B,0xA8,0xBD,0x82,0x97,0xFC,0xE9,0xD6,0xC3},
+{0x00,0x16,0x2C,0x3A,0x58,0x4E,0x74,0x62,0xB0,0xA6,0x9C,0x8A,0xE8,0xFE,0xC4,0xD2},
+{0x00,0x17,0x2E,0x39,0x5C,0x4B,0x72,0x65,0xB8,0xAF,0x96,0x81,0xE4,0xF3,0xCA,0xDD},
+{0x00,0x18,0x30,0x28,0x60,0x78,0x50,0x48,0xC0,0xD8,0xF0,0xE8,0xA0,0xB8,0x90,0x88},
+{0x00,0x19,0x32,0x2B,0x64,0x7D,0x56,0x4F,0xC8,0xD1,0xFA,0xE3,0xAC,0xB5,0x9E,0x87},
+{0x00,0x1A,0x34,0x2E,0x68,0x72,0x5C,0x46,0xD0,0xCA,0xE4,0xFE,0xB8,0xA2,0x8C,0x96},
+{0x00,0x1B,0x36,0x2D,0x6C,0x77,0x5A,0x41,0xD8,0xC3,0xEE,0xF5,0xB4,0xAF,0x82,0x99},
+{0x00,0x1C,0x38,0x24,0x70,0x6C,0x48,0x54,0xE0,0xFC,0xD8,0xC4,0x90,0x8C,0xA8,0xB4},
+{0x00,0x1D,0x3A,0x27,0x74,0x69,0x4E,0x53,0xE8,0xF5,0xD2,0xCF,0x9C,0x81,0xA6,0xBB},
+{0x00,0x1E,0x3C,0x22,0x78,0x66,0x44,0x5A,0xF0,0xEE,0xCC,0xD2,0x88,0x96,0xB4,0xAA},
+{0x00,0x1F,0x3E,0x21,0x7C,0x63,0x42,0x5D,0xF8,0xE7,0xC6,0xD9,0x84,0x9B,0xBA,0xA5},
+{0x00,0x20,0x40,0x60,0x80,0xA0,0xC0,0xE0,0x87,0xA7,0xC7,0xE7,0x07,0x27,0x47,0x67},
+{0x00,0x21,0x42,0x63,0x84,0xA5,0xC6,0xE7,0x8F,0xAE,0xCD,0xEC,0x0B,0x2A,0x49,0x68},
+{0x00,0x22,0x44,0x66,0x88,0xAA,0xCC,0xEE,0x97,0xB5,0xD3,0xF1,0x1F,0x3D,0x5B,0x79},
+{0x00,0x23,0x46,0x65,0x8C,0xAF,0xCA,0xE9,0x9F,0xBC,0xD9,0xFA,0x13,0x30,0x55,0x76},
+{0x00,0x24,0x48,0x6C,0x90,0xB4,0xD8,0xFC,0xA7,0x83,0xEF,0xCB,0x37,0x13,0x7F,0x5B},
+{0x00,0x25,0x4A,0x6F,0x94,0xB1,0xDE,0xFB,0xAF,0x8A,0xE5,0xC0,0x3B,0x1E,0x71,0x54},
+{0x00,0x26,0x4C,0x6A,0x98,0xBE,0xD4,0xF2,0xB7,0x91,0xFB,0xDD,0x2F,0x09,0x63,0x45},
+{0x00,0x27,0x4E,0x69,0x9C,0xBB,0xD2,0xF5,0xBF,0x98,0xF1,0xD6,0x23,0x04,0x6D,0x4A},
+{0x00,0x28,0x50,0x78,0xA0,0x88,0xF0,0xD8,0xC7,0xEF,0x97,0xBF,0x67,0x4F,0x37,0x1F},
+{0x00,0x29,0x52,0x7B,0xA4,0x8D,0xF6,0xDF,0xCF,0xE6,0x9D,0xB4,0x6B,0x42,0x39,0x10},
+{0x00,0x2A,0x54,0x7E,0xA8,0x82,0xFC,0xD6,0xD7,0xFD,0x83,0xA9,0x7F,0x55,0x2B,0x01},
+{0x00,0x2B,0x56,0x7D,0xAC,0x87,0xFA,0xD1,0xDF,0xF4,0x89,0xA2,0x73,0x58,0x25,0x0E},
+{0x00,0x2C,0x58,0x74,0xB0,0x9C,0xE8,0xC4,0xE7,0xCB,0xBF,0x93,0x57,0x7B,0x0F,0x23},
+{0x00,0x2D,0x5A,0x77,0xB4,0x99,0xEE,0xC3,0xEF,0xC2,0xB5,0x98,0x5B,0x76,0x01,0x2C},
+{0x00,0x2E,0x5C,0x72,0xB8,0x96,0xE4,0xCA,0xF7,0xD9,0xAB,0x85,0x4F,0x61,0x13,0x3D},
+{0x00,0x2F,0x5E,0x71,0xBC,0x93,0xE2,0xCD,0xFF,0xD0,0xA1,0x8E,0x43,0x6C,0x1D,0x32},
+{0x00,0x30,0x60,0x50,0xC0,0xF0,0xA0,0x90,0x07,0x37,0x67,0x57,0xC7,0xF7,0xA7,0x97},
+{0x00,0x31,0x62,0x53,0xC4,0xF5,0xA6,0x97,0x0F,0x3E,0x6D,0x5C,0xCB,0xFA,0xA9,0x98},
+{0x00,0x32,0x64,0x56,0xC8,0xFA,0xAC,0x9E,0x17,0x25,0x73,0x41,0xDF,0xED,0xBB,0x89},
+{0x00,0x33,0x66,0x55,0xCC,0xFF,0xAA,0x99,0x1F,0x2C,0x79,0x4A,0xD3,0xE0,0xB5,0x86},
+{0x00,0x34,0x68,0x5C,0xD0,0xE4,0xB8,0x8C,0x27,0x13,0x4F,0x7B,0xF7,0xC3,0x9F,0xAB},
+{0x00,0x35,0x6A,0x5F,0xD4,0xE1,0xBE,0x8B,0x2F,0x1A,0x45,0x70,0xFB,0xCE,0x91,0xA4},
+{0x00,0x36,0x6C,0x5A,0xD8,0xEE,0xB4,0x82,0x37,0x01,0x5B,0x6D,0xEF,0xD9,0x83,0xB5},
+{0x00,0x37,0x6E,0x59,0xDC,0xEB,0xB2,0x85,0x3F,0x08,0x51,0x66,0xE3,0xD4,0x8D,0xBA},
+{0x00,0x38,0x70,0x48,0xE0,0xD8,0x90,0xA8,0x47,0x7F,0x37,0x0F,0xA7,0x9F,0xD7,0xEF},
+{0x00,0x39,0x72,0x4B,0xE4,0xDD,0x96,0xAF,0x4F,0x76,0x3D,0x04,0xAB,0x92,0xD9,0xE0},
+{0x00,0x3A,0x74,0x4E,0xE8,0xD2,0x9C,0xA6,0x57,0x6D,0x23,0x19,0xBF,0x85,0xCB,0xF1},
+{0x00,0x3B,0x76,0x4D,0xEC,0xD7,0x9A,0xA1,0x5F,0x64,0x29,0x12,0xB3,0x88,0xC5,0xFE},
+{0x00,0x3C,0x78,0x44,0xF0,0xCC,0x88,0xB4,0x67,0x5B,0x1F,0x23,0x97,0xAB,0xEF,0xD3},
+{0x00,0x3D,0x7A,0x47,0xF4,0xC9,0x8E,0xB3,0x6F,0x52,0x15,0x28,0x9B,0xA6,0xE1,0xDC},
+{0x00,0x3E,0x7C,0x42,0xF8,0xC6,0x84,0xBA,0x77,0x49,0x0B,0x35,0x8F,0xB1,0xF3,0xCD},
+{0x00,0x3F,0x7E,0x41,0xFC,0xC3,0x82,0xBD,0x7F,0x40,0x01,0x3E,0x83,0xBC,0xFD,0xC2},
+{0x00,0x40,0x80,0xC0,0x87,0xC7,0x07,0x47,0x89,0xC9,0x09,0x49,0x0E,0x4E,0x8E,0xCE},
+{0x00,0x41,0x82,0xC3,0x83,0xC2,0x01,0x40,0x81,0xC0,0x03,0x42,0x02,0x43,0x80,0xC1},
+{0x00,0x42,0x84,0xC6,0x8F,0xCD,0x0B,0x49,0x99,0xDB,0x1D,0x5F,0x16,0x54,0x92,0xD0},
+{0x00,0x43,0x86,0xC5,0x8B,0xC8,0x0D,0x4E,0x91,0xD2,0x17,0x54,0x1A,0x59,0x9C,0xDF},
+{0x00,0x44,0x88,0xCC,0x97,0xD3,0x1F,0x5B,0xA9,0xED,0x21,0x65,0x3E,0x7A,0xB6,0xF2},
+{0x00,0x45,0x8A,0xCF,0x93,0xD6,0x19,0x5C,0xA1,0xE4,0x2B,0x6E,0x32,0x77,0xB8,0xFD},
+{0x00,0x46,0x8C,0xCA,0x9F,0xD9,0x13,0x55,0xB9,0xFF,0x35,0x73,0x26,0x60,0xAA,0xEC},
+{0x00,0x47,0x8E,0xC9,0x9B,0xDC,0x15,0x52,0xB1,0xF6,0x3F,0x78,0x2A,0x6D,0xA4,0xE3},
+{0x00,0x48,0x90,0xD8,0xA7,0xEF,0x37,0x7F,0xC9,0x81,0x59,0x11,0x6E,0x26,0xFE,0xB6},
+{0x00,0x49,0x92,0xDB,0xA3,0xEA,0x31,0x78,0xC1,0x88,0x53,0x1A,0x62,0x2B,0xF0,0xB9},
+{0x00,0x4A,0x94,0xDE,0xAF,0xE5,0x3B,0x71,0xD9,0x93,0x4D,0x07,0x76,0x3C,0xE2,0xA8},
+{0x00,0x4B,0x96,0xDD,0xAB,0xE0,0x3D,0x76,0xD1,0x9A,0x47,0x0C,0x7A,0x31,0xEC,0xA7},
+{0x00,0x4C,0x98,0xD4,0xB7,0xFB,0x2F,0x63,0xE9,0xA5,0x71,0x3D,0x5E,0x12,0xC6,0x8A},
+{0x00,0x4D,0x9A,0xD7,0xB3,0xFE,0x29,0x64,0xE1,0xAC,0x7B,0x36,0x52,0x1F,0xC8,0x85},
+{0x00,0x4E,0x9C,0xD2,0xBF,0xF1,0x23,0x6D,0xF9,0xB7,0x65,0x2B,0x46,0x08,0xDA,0x94},
+{0x00,0x4F,0x9E,0xD1,0xBB,0xF4,0x25,0x6A,0xF1,0xBE,0x6F,0x20,0x4A,0x05,0xD4,0x9B},
+{0x00,0x50,0xA0,0xF0,0xC7,0x97,0x67,0x37,0x09,0x59,0xA9,0xF9,0xCE,0x9E,0x6E,0x3E},
+{0x00,0x51,0xA2,0xF3,0xC3,0x92,0x61,0x30,0x01,0x50,0xA3,0xF2,0xC2,0x93,0x60,0x31},
+{0x00,0x52,0xA4,0xF6,0xCF,0x9D,0x6B,0x39,0x19,0x4B,0xBD,0xEF,0xD6,0x84,0x72,0x20},
+{0x00,0x53,0xA6,0xF5,0xCB,0x98,0x6D,0x3E,0x11,0x42,0xB7,0xE4,0xDA,0x89,0x7C,0x2F},
+{0x00,0x54,0xA8,0xFC,0xD7,0x83,0x7F,0x2B,0x29,0x7D,0x81,0xD5,0xFE,0xAA,0x56,0x02},
+{0x00,0x55,0xAA,0xFF,0xD3,0x86,0x79,0x2C,0x21,0x74,0x8B,0xDE,0xF2,0xA7,0x58,0x0D},
+{0x00,0x56,0xAC,0xFA,0xDF,0x89,0x73,0x25,0x39,0x6F,0x95,0xC3,0xE6,0xB0,0x4A,0x1C},
+{0x00,0x57,0xAE,0xF9,0xDB,0x8C,0x75,0x22,0x31,0x66,0x9F,0xC8,0xEA,0xBD,0x44,0x13},
+{0x00,0x58,0xB0,0xE8,0xE7,0xBF,0x57,0x0F,0x49,0x11,0xF9,0xA1,0xAE,0xF6,0x1E,0x46},
+{0x00,0x59,0xB2,0xEB,0xE3,0xBA,0x51,0x08,0x41,0x18,0xF3,0xAA,0xA2,0xFB,0x10,0x49},
+{0x00,0x5A,0xB4,0xEE,0xEF,0xB5,0x5B,0x01,0x59,0x03,0xED,0xB7,0xB6,0xEC,0x02,0x58},
+{0x00,0x5B,0xB6,0xED,0xEB,0xB0,0x5D,0x06,0x51,0x0A,0xE7,0xBC,0xBA,0xE1,0x0C,0x57},
+{0x00,0x5C,0xB8,0xE4,0xF7,0xAB,0x4F,0x13,0x69,0x35,0xD1,0x8D,0x9E,0xC2,0x26,0x7A},
+{0x00,0x5D,0xBA,0xE7,0xF3,0xAE,0x49,0x14,0x61,0x3C,0xDB,0x86,0x92,0xCF,0x28,0x75},
+{0x00,0x5E,0xBC,0xE2,0xFF,0xA1,0x43,0x1D,0x79,0x27,0xC5,0x9B,0x86,0xD8,0x3A,0x64},
+{0x00,0x5F,0xBE,0xE1,0xFB,0xA4,0x45,0x1A,0x71,0x2E,0xCF,0x90,0x8A,0xD5,0x34,0x6B},
+{0x00,0x60,0xC0,0xA0,0x07,0x67,0xC7,0xA7,0x0E,0x6E,0xCE,0xAE,0x09,0x69,0xC9,0xA9},
+{0x00,0x61,0xC2,0xA3,0x03,0x62,0xC1,0xA0,0x06,0x67,0xC4,0xA5,0x05,0x64,0xC7,0xA6},
+{0x00,0x62,0xC4,0xA6,0x0F,0x6D,0xCB,0xA9,0x1E,0x7C,0xDA,0xB8,0x11,0x73,0xD5,0xB7},
+{0x00,0x63,0xC6,0xA5,0x0B,0x68,0xCD,0xAE,0x16,0x75,0xD0,0xB3,0x1D,0x7E,0xDB,0xB8},
+{0x00,0x64,0xC8,0xAC,0x17,0x73,0xDF,0xBB,0x2E,0x4A,0xE6,0x82,0x39,0x5D,0xF1,0x95},
+{0x00,0x65,0xCA,0xAF,0x13,0x76,0xD9,0xBC,0x26,0x43,0xEC,0x89,0x35,0x50,0xFF,0x9A},
+{0x00,0x66,0xCC,0xAA,0x1F,0x79,0xD3,0xB5,0x3E,0x58,0xF2,0x94,0x21,0x47,0xED,0x8B},
+{0x00,0x67,0xCE,0xA9,0x1B,0x7C,0xD5,0xB2,0x36,0x51,0xF8,0x9F,0x2D,0x4A,0xE3,0x84},
+{0x00,0x68,0xD0,0xB8,0x27,0x4F,0xF7,0x9F,0x4E,0x26,0x9E,0xF6,0x69,0x01,0xB9,0xD1},
+{0x00,0x69,0xD2,0xBB,0x23,0x4A,0xF1,0x98,0x46,0x2F,0x94,0xFD,0x65,0x0C,0xB7,0xDE},
+{0x00,0x6A,0xD4,0xBE,0x2F,0x45,0xFB,0x91,0x5E,0x34,0x8A,0xE0,0x71,0x1B,0xA5,0xCF},
+{0x00,0x6B,0xD6,0xBD,0x2B,0x40,0xFD,0x96,0x56,0x3D,0x80,0xEB,0x7D,0x16,0xAB,0xC0},
+{0x00,0x6C,0xD8,0xB4,0x37,0x5B,0xEF,0x83,0x6E,0x02,0xB6,0xDA,0x59,0x35,0x81,0xED},
+{0x00,0x6D,0xDA,0xB7,0x33,0x5E,0xE9,0x84,0x66,0x0B,0xBC,0xD1,0x55,0x38,0x8F,0xE2},
+{0x00,0x6E,0xDC,0xB2,0x3F,0x51,0xE3,0x8D,0x7E,0x10,0xA2,0xCC,0x41,0x2F,0x9D,0xF3},
+{0x00,0x6F,0xDE,0xB1,0x3B,0x54,0xE5,0x8A,0x76,0x19,0xA8,0xC7,0x4D,0x22,0x93,0xFC},
+{0x00,0x70,0xE0,0x90,0x47,0x37,0xA7,0xD7,0x8E,0xFE,0x6E,0x1E,0xC9,0xB9,0x29,0x59},
+{0x00,0x71,0xE2,0x93,0x43,0x32,0xA1,0xD0,0x86,0xF7,0x64,0x15,0xC5,0xB4,0x27,0x56},
+{0x00,0x72,0xE4,0x96,0x4F,0x3D,0xAB,0xD9,0x9E,0xEC,0x7A,0x08,0xD1,0xA3,0x35,0x47},
+{0x00,0x73,0xE6,0x95,0x4B,0x38,0xAD,0xDE,0x96,0xE5,0x70,0x03,0xDD,0xAE,0x3B,0x48},
+{0x00,0x74,0xE8,0x9C,0x57,0x23,0xBF,0xCB,0xAE,0xDA,0x46,0x32,0xF9,0x8D,0x11,0x65},
+{0x00,0x75,0xEA,0x9F,0x53,0x26,0xB9,0xCC,0xA6,0xD3,0x4C,0x39,0xF5,0x80,0x1F,0x6A},
+{0x00,0x76,0xEC,0x9A,0x5F,0x29,0xB3,0xC5,0xBE,0xC8,0x52,0x24,0xE1,0x97,0x0D,0x7B},
+{0x00,0x77,0xEE,0x99,0x5B,0x2C,0xB5,0xC2,0xB6,0xC1,0x58,0x2F,0xED,0x9A,0x03,0x74},
+{0x00,0x78,0xF0,0x88,0x67,0x1F,0x97,0xEF,0xCE,0xB6,0x3E,0x46,0xA9,0xD1,0x59,0x21},
+{0x00,0x79,0xF2,0x8B,0x63,0x1A,0x91,0xE8,0xC6,0xBF,0x34,0x4D,0xA5,0xDC,0x57,0x2E},
+{0x00,0x7A,0xF4,0x8E,0x6F,0x15,0x9B,0xE1,0xDE,0xA4,0x2A,0x50,0xB1,0xCB,0x45,0x3F},
+{0x00,0x7B,0xF6,0x8D,0x6B,0x10,0x9D,0xE6,0xD6,0xAD,0x20,0x5B,0xBD,0xC6,0x4B,0x30},
+{0x00,0x7C,0xF8,0x84,0x77,0x0B,0x8F,0xF3,0xEE,0x92,0x16,0x6A,0x99,0xE5,0x61,0x1D},
+{0x00,0x7D,0xFA,0x87,0x73,0x0E,0x89,0xF4,0xE6,0x9B,0x1C,0x61,0x95,0xE8,0x6F,0x12},
+{0x00,0x7E,0xFC,0x82,0x7F,0x01,0x83,0xFD,0xFE,0x80,0x02,0x7C,0x81,0xFF,0x7D,0x03},
+{0x00,0x7F,0xFE,0x81,0x7B,0x04,0x85,0xFA,0xF6,0x89,0x08,0x77,0x8D,0xF2,0x73,0x0C},
+{0x00,0x80,0x87,0x07,0x89,0x09,0x0E,0x8E,0x95,0x15,0x12,0x92,0x1C,0x9C,0x9B,0x1B},
+{0x00,0x81,0x85,0x04,0x8D,0x0C,0x08,0x89,0x9D,0x1C,0x18,0x99,0x10,0x91,0x95,0x14},
+{0x00,0x82,0x83,0x01,0x81,0x03,0x02,0x80,0x85,0x07,0x06,0x84,0x04,0x86,0x87,0x05},
+{0x00,0x83,0x81,0x02,0x85,0x06,0x04,0x87,0x8D,0x0E,0x0C,0x8F,0x08,0x8B,0x89,0x0A},
+{0x00,0x84,0x8F,0x0B,0x99,0x1D,0x16,0x92,0xB5,0x31,0x3A,0xBE,0x2C,0xA8,0xA3,0x27},
+{0x00,0x85,0x8D,0x08,0x9D,0x18,0x10,0x95,0xBD,0x38,0x30,0xB5,0x20,0xA5,0xAD,0x28},
+{0x00,0x86,0x8B,0x0D,0x91,0x17,0x1A,0x9C,0xA5,0x23,0x2E,0xA8,0x34,0xB2,0xBF,0x39},
+{0x00,0x87,0x89,0x0E,0x95,0x12,0x1C,0x9B,0xAD,0x2A,0x24,0xA3,0x38,0xBF,0xB1,0x36},
+{0x00,0x88,0x97,0x1F,0xA9,0x21,0x3E,0xB6,0xD5,0x5D,0x42,0xCA,0x7C,0xF4,0xEB,0x63},
+{0x00,0x89,0x95,0x1C,0xAD,0x24,0x38,0xB1,0xDD,0x54,0x48,0xC1,0x70,0xF9,0xE5,0x6C},
+{0x00,0x8A,0x93,0x19,0xA1,0x2B,0x32,0xB8,0xC5,0x4F,0x56,0xDC,0x64,0xEE,0xF7,0x7D},
+{0x00,0x8B,0x91,0x1A,0xA5,0x2E,0x34,0xBF,0xCD,0x46,0x5C,0xD7,0x68,0xE3,0xF9,0x72},
+{0x00,0x8C,0x9F,0x13,0xB9,0x35,0x26,0xAA,0xF5,0x79,0x6A,0xE6,0x4C,0xC0,0xD3,0x5F},
+{0x00,0x8D,0x9D,0x10,0xBD,0x30,0x20,0xAD,0xFD,0x70,0x60,0xED,0x40,0xCD,0xDD,0x50},
+{0x00,0x8E,0x9B,0x15,0xB1,0x3F,0x2A,0xA4,0xE5,0x6B,0x7E,0xF0,0x54,0xDA,0xCF,0x41},
+{0x00,0x8F,0x99,0x16,0xB5,0x3A,0x2C,0xA3,0xED,0x62,0x74,0xFB,0x58,0xD7,0xC1,0x4E},
+{0x00,0x90,0xA7,0x37,0xC9,0x59,0x6E,0xFE,0x15,0x85,0xB2,0x22,0xDC,0x4C,0x7B,0xEB},
+{0x00,0x91,0xA5,0x34,0xCD,0x5C,0x68,0xF9,0x1D,0x8C,0xB8,0x29,0xD0,0x41,0x75,0xE4},
+{0x00,0x92,0xA3,0x31,0xC1,0x53,0x62,0xF0,0x05,0x97,0xA6,0x34,0xC4,0x56,0x67,0xF5},
+{0x00,0x93,0xA1,0x32,0xC5,0x56,0x64,0xF7,0x0D,0x9E,0xAC,0x3F,0xC8,0x5B,0x69,0xFA},
+{0x00,0x94,0xAF,0x3B,0xD9,0x4D,0x76,0xE2,0x35,0xA1,0x9A,0x0E,0xEC,0x78,0x43,0xD7},
+{0x00,0x95,0xAD,0x38,0xDD,0x48,0x70,0xE5,0x3D,0xA8,0x90,0x05,0xE0,0x75,0x4D,0xD8},
+{0x00,0x96,0xAB,0x3D,0xD1,0x47,0x7A,0xEC,0x25,0xB3,0x8E,0x18,0xF4,0x62,0x5F,0xC9},
+{0x00,0x97,0xA9,0x3E,0xD5,0x42,0x7C,0xEB,0x2D,0xBA,0x84,0x13,0xF8,0x6F,0x51,0xC6},
+{0x00,0x98,0xB7,0x2F,0xE9,0x71,0x5E,0xC6,0x55,0xCD,0xE2,0x7A,0xBC,0x24,0x0B,0x93},
+{0x00,0x99,0xB5,0x2C,0xED,0x74,0x58,0xC1,0x5D,0xC4,0xE8,0x71,0xB0,0x29,0x05,0x9C},
+{0x00,0x9A,0xB3,0x29,0xE1,0x7B,0x52,0xC8,0x45,0xDF,0xF6,0x6C,0xA4,0x3E,0x17,0x8D},
+{0x00,0x9B,0xB1,0x2A,0xE5,0x7E,0x54,0xCF,0x4D,0xD6,0xFC,0x67,0xA8,0x33,0x19,0x82},
+{0x00,0x9C,0xBF,0x23,0xF9,0x65,0x46,0xDA,0x75,0xE9,0xCA,0x56,0x8C,0x10,0x33,0xAF},
+{0x00,0x9D,0xBD,0x20,0xFD,0x60,0x40,0xDD,0x7D,0xE0,0xC0,0x5D,0x80,0x1D,0x3D,0xA0},
+{0x00,0x9E,0xBB,0x25,0xF1,0x6F,0x4A,0xD4,0x65,0xFB,0xDE,0x40,0x94,0x0A,0x2F,0xB1},
+{0x00,0x9F,0xB9,0x26,0xF5,0x6A,0x4C,0xD3,0x6D,0xF2,0xD4,0x4B,0x98,0x07,0x21,0xBE},
+{0x00,0xA0,0xC7,0x67,0x09,0xA9,0xCE,0x6E,0x12,0xB2,0xD5,0x75,0x1B,0xBB,0xDC,0x7C},
+{0x00,0xA1,0xC5,0x64,0x0D,0xAC,0xC8,0x69,0x1A,0xBB,0xDF,0x7E,0x17,0xB6,0xD2,0x73},
+{0x00,0xA2,0xC3,0x61,0x01,0xA3,0xC2,0x60,0x02,0xA0,0xC1,0x63,0x03,0xA1,0xC0,0x62},
+{0x00,0xA3,0xC1,0x62,0x05,0xA6,0xC4,0x67,0x0A,0xA9,0xCB,0x68,0x0F,0xAC,0xCE,0x6D},
+{0x00,0xA4,0xCF,0x6B,0x19,0xBD,0xD6,0x72,0x32,0x96,0xFD,0x59,0x2B,0x8F,0xE4,0x40},
+{0x00,0xA5,0xCD,0x68,0x1D,0xB8,0xD0,0x75,0x3A,0x9F,0xF7,0x52,0x27,0x82,0xEA,0x4F},
+{0x00,0xA6,0xCB,0x6D,0x11,0xB7,0xDA,0x7C,0x22,0x84,0xE9,0x4F,0x33,0x95,0xF8,0x5E},
+{0x00,0xA7,0xC9,0x6E,0x15,0xB2,0xDC,0x7B,0x2A,0x8D,0xE3,0x44,0x3F,0x98,0xF6,0x51},
+{0x00,0xA8,0xD7,0x7F,0x29,0x81,0xFE,0x56,0x52,0xFA,0x85,0x2D,0x7B,0xD3,0xAC,0x04},
+{0x00,0xA9,0xD5,0x7C,0x2D,0x84,0xF8,0x51,0x5A,0xF3,0x8F,0x26,0x77,0xDE,0xA2,0x0B},
+{0x00,0xAA,0xD3,0x79,0x21,0x8B,0xF2,0x58,0x42,0xE8,0x91,0x3B,0x63,0xC9,0xB0,0x1A},
+{0x00,0xAB,0xD1,0x7A,0x25,0x8E,0xF4,0x5F,0x4A,0xE1,0x9B,0x30,0x6F,0xC4,0xBE,0x15},
+{0x00,0xAC,0xDF,0x73,0x39,0x95,0xE6,0x4A,0x72,0xDE,0xAD,0x01,0x4B,0xE7,0x94,0x38},
+{0x00,0xAD,0xDD,0x70,0x3D,0x90,0xE0,0x4D,0x7A,0xD7,0xA7,0x0A,0x47,0xEA,0x9A,0x37},
+{0x00,0xAE,0xDB,0x75,0x31,0x9F,0xEA,0x44,0x62,0xCC,0xB9,0x17,0x53,0xFD,0x88,0x26},
+{0x00,0xAF,0xD9,0x76,0x35,0x9A,0xEC,0x43,0x6A,0xC5,0xB3,0x1C,0x5F,0xF0,0x86,0x29},
+{0x00,0xB0,0xE7,0x57,0x49,0xF9,0xAE,0x1E,0x92,0x22,0x75,0xC5,0xDB,0x6B,0x3C,0x8C},
+{0x00,0xB1,0xE5,0x54,0x4D,0xFC,0xA8,0x19,0x9A,0x2B,0x7F,0xCE,0xD7,0x66,0x32,0x83},
+{0x00,0xB2,0xE3,0x51,0x41,0xF3,0xA2,0x10,0x82,0x30,0x61,0xD3,0xC3,0x71,0x20,0x92},
+{0x00,0xB3,0xE1,0x52,0x45,0xF6,0xA4,0x17,0x8A,0x39,0x6B,0xD8,0xCF,0x7C,0x2E,0x9D},
+{0x00,0xB4,0xEF,0x5B,0x59,0xED,0xB6,0x02,0xB2,0x06,0x5D,0xE9,0xEB,0x5F,0x04,0xB0},
+{0x00,0xB5,0xED,0x58,0x5D,0xE8,0xB0,0x05,0xBA,0x0F,0x57,0xE2,0xE7,0x52,0x0A,0xBF},
+{0x00,0xB6,0xEB,0x5D,0x51,0xE7,0xBA,0x0C,0xA2,0x14,0x49,0xFF,0xF3,0x45,0x18,0xAE},
+{0x00,0xB7,0xE9,0x5E,0x55,0xE2,0xBC,0x0B,0xAA,0x1D,0x43,0xF4,0xFF,0x48,0x16,0xA1},
+{0x00,0xB8,0xF7,0x4F,0x69,0xD1,0x9E,0x26,0xD2,0x6A,0x25,0x9D,0xBB,0x03,0x4C,0xF4},
+{0x00,0xB9,0xF5,0x4C,0x6D,0xD4,0x98,0x21,0xDA,0x63,0x2F,0x96,0xB7,0x0E,0x42,0xFB},
+{0x00,0xBA,0xF3,0x49,0x61,0xDB,0x92,0x28,0xC2,0x78,0x31,0x8B,0xA3,0x19,0x50,0xEA},
+{0x00,0xBB,0xF1,0x4A,0x65,0xDE,0x94,0x2F,0xCA,0x71,0x3B,0x80,0xAF,0x14,0x5E,0xE5},
+{0x00,0xBC,0xFF,0x43,0x79,0xC5,0x86,0x3A,0xF2,0x4E,0x0D,0xB1,0x8B,0x37,0x74,0xC8},
+{0x00,0xBD,0xFD,0x40,0x7D,0xC0,0x80,0x3D,0xFA,0x47,0x07,0xBA,0x87,0x3A,0x7A,0xC7},
+{0x00,0xBE,0xFB,0x45,0x71,0xCF,0x8A,0x34,0xE2,0x5C,0x19,0xA7,0x93,0x2D,0x68,0xD6},
+{0x00,0xBF,0xF9,0x46,0x75,0xCA,0x8C,0x33,0xEA,0x55,0x13,0xAC,0x9F,0x20,0x66,0xD9},
+{0x00,0xC0,0x07,0xC7,0x0E,0xCE,0x09,0xC9,0x1C,0xDC,0x1B,0xDB,0x12,0xD2,0x15,0xD5},
+{0x00,0xC1,0x05,0xC4,0x0A,0xCB,0x0F,0xCE,0x14,0xD5,0x11,0xD0,0x1E,0xDF,0x1B,0xDA},
+{0x00,0xC2,0x03,0xC1,0x06,0xC4,0x05,0xC7,0x0C,0xCE,0x0F,0xCD,0x0A,0xC8,0x09,0xCB},
+{0x00,0xC3,0x01,0xC2,0x02,0xC1,0x03,0xC0,0x04,0xC7,0x05,0xC6,0x06,0xC5,0x07,0xC4},
+{0x00,0xC4,0x0F,0xCB,0x1E,0xDA,0x11,0xD5,0x3C,0xF8,0x33,0xF7,0x22,0xE6,0x2D,0xE9},
+{0x00,0xC5,0x0D,0xC8,0x1A,0xDF,0x17,0xD2,0x34,0xF1,0x39,0xFC,0x2E,0xEB,0x23,0xE6},
+{0x00,0xC6,0x0B,0xCD,0x16,0xD0,0x1D,0xDB,0x2C,0xEA,0x27,0xE1,0x3A,0xFC,0x31,0xF7},
+{0x00,0xC7,0x09,0xCE,0x12,0xD5,0x1B,0xDC,0x24,0xE3,0x2D,0xEA,0x36,0xF1,0x3F,0xF8},
+{0x00,0xC8,0x17,0xDF,0x2E,0xE6,0x39,0xF1,0x5C,0x94,0x4B,0x83,0x72,0xBA,0x65,0xAD},
+{0x00,0xC9,0x15,0xDC,0x2A,0xE3,0x3F,0xF6,0x54,0x9D,0x41,0x88,0x7E,0xB7,0x6B,0xA2},
+{0x00,0xCA,0x13,0xD9,0x26,0xEC,0x35,0xFF,0x4C,0x86,0x5F,0x95,0x6A,0xA0,0x79,0xB3},
+{0x00,0xCB,0x11,0xDA,0x22,0xE9,0x33,0xF8,0x44,0x8F,0x55,0x9E,0x66,0xAD,0x77,0xBC},
+{0x00,0xCC,0x1F,0xD3,0x3E,0xF2,0x21,0xED,0x7C,0xB0,0x63,0xAF,0x42,0x8E,0x5D,0x91},
+{0x00,0xCD,0x1D,0xD0,0x3A,0xF7,0x27,0xEA,0x74,0xB9,0x69,0xA4,0x4E,0x83,0x53,0x9E},
+{0x00,0xCE,0x1B,0xD5,0x36,0xF8,0x2D,0xE3,0x6C,0xA2,0x77,0xB9,0x5A,0x94,0x41,0x8F},
+{0x00,0xCF,0x19,0xD6,0x32,0xFD,0x2B,0xE4,0x64,0xAB,0x7D,0xB2,0x56,0x99,0x4F,0x80},
+{0x00,0xD0,0x27,0xF7,0x4E,0x9E,0x69,0xB9,0x9C,0x4C,0xBB,0x6B,0xD2,0x02,0xF5,0x25},
+{0x00,0xD1,0x25,0xF4,0x4A,0x9B,0x6F,0xBE,0x94,0x45,0xB1,0x60,0xDE,0x0F,0xFB,0x2A},
+{0x00,0xD2,0x23,0xF1,0x46,0x94,0x65,0xB7,0x8C,0x5E,0xAF,0x7D,0xCA,0x18,0xE9,0x3B},
+{0x00,0xD3,0x21,0xF2,0x42,0x91,0x63,0xB0,0x84,0x57,0xA5,0x76,0xC6,0x15,0xE7,0x34},
+{0x00,0xD4,0x2F,0xFB,0x5E,0x8A,0x71,0xA5,0xBC,0x68,0x93,0x47,0xE2,0x36,0xCD,0x19},
+{0x00,0xD5,0x2D,0xF8,0x5A,0x8F,0x77,0xA2,0xB4,0x61,0x99,0x4C,0xEE,0x3B,0xC3,0x16},
+{0x00,0xD6,0x2B,0xFD,0x56,0x80,0x7D,0xAB,0xAC,0x7A,0x87,0x51,0xFA,0x2C,0xD1,0x07},
+{0x00,0xD7,0x29,0xFE,0x52,0x85,0x7B,0xAC,0xA4,0x73,0x8D,0x5A,0xF6,0x21,0xDF,0x08},
+{0x00,0xD8,0x37,0xEF,0x6E,0xB6,0x59,0x81,0xDC,0x04,0xEB,0x33,0xB2,0x6A,0x85,0x5D},
+{0x00,0xD9,0x35,0xEC,0x6A,0xB3,0x5F,0x86,0xD4,0x0D,0xE1,0x38,0xBE,0x67,0x8B,0x52},
+{0x00,0xDA,0x33,0xE9,0x66,0xBC,0x55,0x8F,0xCC,0x16,0xFF,0x25,0xAA,0x70,0x99,0x43},
+{0x00,0xDB,0x31,0xEA,0x62,0xB9,0x53,0x88,0xC4,0x1F,0xF5,0x2E,0xA6,0x7D,0x97,0x4C},
+{0x00,0xDC,0x3F,0xE3,0x7E,0xA2,0x41,0x9D,0xFC,0x20,0xC3,0x1F,0x82,0x5E,0xBD,0x61},
+{0x00,0xDD,0x3D,0xE0,0x7A,0xA7,0x47,0x9A,0xF4,0x29,0xC9,0x14,0x8E,0x53,0xB3,0x6E},
+{0x00,0xDE,0x3B,0xE5,0x76,0xA8,0x4D,0x93,0xEC,0x32,0xD7,0x09,0x9A,0x44,0xA1,0x7F},
+{0x00,0xDF,0x39,0xE6,0x72,0xAD,0x4B,0x94,0xE4,0x3B,0xDD,0x02,0x96,0x49,0xAF,0x70},
+{0x00,0xE0,0x47,0xA7,0x8E,0x6E,0xC9,0x29,0x9B,0x7B,0xDC,0x3C,0x15,0xF5,0x52,0xB2},
+{0x00,0xE1,0x45,0xA4,0x8A,0x6B,0xCF,0x2E,0x93,0x72,0xD6,0x37,0x19,0xF8,0x5C,0xBD},
+{0x00,0xE2,0x43,0xA1,0x86,0x64,0xC5,0x27,0x8B,0x69,0xC8,0x2A,0x0D,0xEF,0x4E,0xAC},
+{0x00,0xE3,0x41,0xA2,0x82,0x61,0xC3,0x20,0x83,0x60,0xC2,0x21,0x01,0xE2,0x40,0xA3},
+{0x00,0xE4,0x4F,0xAB,0x9E,0x7A,0xD1,0x35,0xBB,0x5F,0xF4,0x10,0x25,0xC1,0x6A,0x8E},
+{0x00,0xE5,0x4D,0xA8,0x9A,0x7F,0xD7,0x32,0xB3,0x56,0xFE,0x1B,0x29,0xCC,0x64,0x81},
+{0x00,0xE6,0x4B,0xAD,0x96,0x70,0xDD,0x3B,0xAB,0x4D,0xE0,0x06,0x3D,0xDB,0x76,0x90},
+{0x00,0xE7,0x49,0xAE,0x92,0x75,0xDB,0x3C,0xA3,0x44,0xEA,0x0D,0x31,0xD6,0x78,0x9F},
+{0x00,0xE8,0x57,0xBF,0xAE,0x46,0xF9,0x11,0xDB,0x33,0x8C,0x64,0x75,0x9D,0x22,0xCA},
+{0x00,0xE9,0x55,0xBC,0xAA,0x43,0xFF,0x16,0xD3,0x3A,0x86,0x6F,0x79,0x90,0x2C,0xC5},
+{0x00,0xEA,0x53,0xB9,0xA6,0x4C,0xF5,0x1F,0xCB,0x21,0x98,0x72,0x6D,0x87,0x3E,0xD4},
+{0x00,0xEB,0x51,0xBA,0xA2,0x49,0xF3,0x18,0xC3,0x28,0x92,0x79,0x61,0x8A,0x30,0xDB},
+{0x00,0xEC,0x5F,0xB3,0xBE,0x52,0xE1,0x0D,0xFB,0x17,0xA4,0x48,0x45,0xA9,0x1A,0xF6},
+{0x00,0xED,0x5D,0xB0,0xBA,0x57,0xE7,0x0A,0xF3,0x1E,0xAE,0x43,0x49,0xA4,0x14,0xF9},
+{0x00,0xEE,0x5B,0xB5,0xB6,0x58,0xED,0x03,0xEB,0x05,0xB0,0x5E,0x5D,0xB3,0x06,0xE8},
+{0x00,0xEF,0x59,0xB6,0xB2,0x5D,0xEB,0x04,0xE3,0x0C,0xBA,0x55,0x51,0xBE,0x08,0xE7},
+{0x00,0xF0,0x67,0x97,0xCE,0x3E,0xA9,0x59,0x1B,0xEB,0x7C,0x8C,0xD5,0x25,0xB2,0x42},
+{0x00,0xF1,0x65,0x94,0xCA,0x3B,0xAF,0x5E,0x13,0xE2,0x76,0x87,0xD9,0x28,0xBC,0x4D},
+{0x00,0xF2,0x63,0x91,0xC6,0x34,0xA5,0x57,0x0B,0xF9,0x68,0x9A,0xCD,0x3F,0xAE,0x5C},
+{0x00,0xF3,0x61,0x92,0xC2,0x31,0xA3,0x50,0x03,0xF0,0x62,0x91,0xC1,0x32,0xA0,0x53},
+{0x00,0xF4,0x6F,0x9B,0xDE,0x2A,0xB1,0x45,0x3B,0xCF,0x54,0xA0,0xE5,0x11,0x8A,0x7E},
+{0x00,0xF5,0x6D,0x98,0xDA,0x2F,0xB7,0x42,0x33,0xC6,0x5E,0xAB,0xE9,0x1C,0x84,0x71},
+{0x00,0xF6,0x6B,0x9D,0xD6,0x20,0xBD,0x4B,0x2B,0xDD,0x40,0xB6,0xFD,0x0B,0x96,0x60},
+{0x00,0xF7,0x69,0x9E,0xD2,0x25,0xBB,0x4C,0x23,0xD4,0x4A,0xBD,0xF1,0x06,0x98,0x6F},
+{0x00,0xF8,0x77,0x8F,0xEE,0x16,0x99,0x61,0x5B,0xA3,0x2C,0xD4,0xB5,0x4D,0xC2,0x3A},
+{0x00,0xF9,0x75,0x8C,0xEA,0x13,0x9F,0x66,0x53,0xAA,0x26,0xDF,0xB9,0x40,0xCC,0x35},
+{0x00,0xFA,0x73,0x89,0xE6,0x1C,0x95,0x6F,0x4B,0xB1,0x38,0xC2,0xAD,0x57,0xDE,0x24},
+{0x00,0xFB,0x71,0x8A,0xE2,0x19,0x93,0x68,0x43,0xB8,0x32,0xC9,0xA1,0x5A,0xD0,0x2B},
+{0x00,0xFC,0x7F,0x83,0xFE,0x02,0x81,0x7D,0x7B,0x87,0x04,0xF8,0x85,0x79,0xFA,0x06},
+{0x00,0xFD,0x7D,0x80,0xFA,0x07,0x87,0x7A,0x73,0x8E,0x0E,0xF3,0x89,0x74,0xF4,0x09},
+{0x00,0xFE,0x7B,0x85,0xF6,0x08,0x8D,0x73,0x6B,0x95,0x10,0xEE,0x9D,0x63,0xE6,0x18},
+{0x00,0xFF,0x79,0x86,0xF2,0x0D,0x8B,0x74,0x63,0x9C,0x1A,0xE5,0x91,0x6E,0xE8,0x17},
+};
+
+static const uint8_t MUL_HI[256][16] = {
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x00,0x10,0x20,0x30,0x40,0x50,0x60,0x70,0x80,0x90,0xA0,0xB0,0xC0,0xD0,0xE0,0xF0},
+{0x00,0x20,0x40,0x60,0x80,0xA0,0xC0,0xE0,0x87,0xA7,0xC7,0xE7,0x07,0x27,0x47,0x67},
+{0x00,0x30,0x60,0x50,0xC0,0xF0,0xA0,0x90,0x07,0x37,0x67,0x57,0xC7,0xF7,0xA7,0x97},
+{0x00,0x40,0x80,0xC0,0x87,0xC7,0x07,0x47,0x89,0xC9,0x09,0x49,0x0E,0x4E,0x8E,0xCE},
+{0x00,0x50,0xA0,0xF0,0xC7,0x97,0x67,0x37,0x09,0x59,0xA9,0xF9,0xCE,0x9E,0x6E,0x3E},
+{0x00,0x60,0xC0,0xA0,0x07,0x67,0xC7,0xA7,0x0E,0x6E,0xCE,0xAE,0x09,0x69,0xC9,0xA9},
+{0x00,0x70,0xE0,0x90,0x47,0x37,0xA7,0xD7,0x8E,0xFE,0x6E,0x1E,0xC9,0xB9,0x29,0x59},
+{0x00,0x80,0x87,0x07,0x89,0x09,0x0E,0x8E,0x95,0x15,0x12,0x92,0x1C,0x9C,0x9B,0x1B},
+{0x00,0x90,0xA7,0x37,0xC9,0x59,0x6E,0xFE,0x15,0x85,0xB2,0x22,0xDC,0x4C,0x7B,0xEB},
+{0x00,0xA0,0xC7,0x67,0x09,0xA9,0xCE,0x6E,0x12,0xB2,0xD5,0x75,0x1B,0xBB,0xDC,0x7C},
+{0x00,0xB0,0xE7,0x57,0x49,0xF9,0xAE,0x1E,0x92,0x22,0x75,0xC5,0xDB,0x6B,0x3C,0x8C},
+{0x00,0xC0,0x07,0xC7,0x0E,0xCE,0x09,0xC9,0x1C,0xDC,0x1B,0xDB,0x12,0xD2,0x15,0xD5},
+{0x00,0xD0,0x27,0xF7,0x4E,0x9E,0x69,0xB9,0x9C,0x4C,0xBB,0x6B,0xD2,0x02,0xF5,0x25},
+{0x00,0xE0,0x47,0xA7,0x8E,0x6E,0xC9,0x29,0x9B,0x7B,0xDC,0x3C,0x15,0xF5,0x52,0xB2},
+{0x00,0xF0,0x67,0x97,0xCE,0x3E,0xA9,0x59,0x1B,0xEB,0x7C,0x8C,0xD5,0x25,0xB2,0x42},
+{0x00,0x87,0x89,0x0E,0x95,0x12,0x1C,0x9B,0xAD,0x2A,0x24,0xA3,0x38,0xBF,0xB1,0x36},
+{0x00,0x97,0xA9,0x3E,0xD5,0x42,0x7C,0xEB,0x2D,0xBA,0x84,0x13,0xF8,0x6F,0x51,0xC6},
+{0x00,0xA7,0xC9,0x6E,0x15,0xB2,0xDC,0x7B,0x2A,0x8D,0xE3,0x44,0x3F,0x98,0xF6,0x51},
+{0x00,0xB7,0xE9,0x5E,0x55,0xE2,0xBC,0x0B,0xAA,0x1D,0x43,0xF4,0xFF,0x48,0x16,0xA1},
+{0x00,0xC7,0x09,0xCE,0x12,0xD5,0x1B,0xDC,0x24,0xE3,0x2D,0xEA,0x36,0xF1,0x3F,0xF8},
+{0x00,0xD7,0x29,0xFE,0x52,0x85,0x7B,0xAC,0xA4,0x73,0x8D,0x5A,0xF6,0x21,0xDF,0x08},
+{0x00,0xE7,0x49,0xAE,0x92,0x75,0xDB,0x3C,0xA3,0x44,0xEA,0x0D,0x31,0xD6,0x78,0x9F},
+{0x00,0xF7,0x69,0x9E,0xD2,0x25,0xBB,0x4C,0x23,0xD4,0x4A,0xBD,0xF1,0x06,0x98,0x6F},
+{0x00,0x07,0x0E,0x09,0x1C,0x1B,0x12,0x15,0x38,0x3F,0x36,0x31,0x24,0x23,0x2A,0x2D},
+{0x00,0x17,0x2E,0x39,0x5C,0x4B,0x72,0x65,0xB8,0xAF,0x96,0x81,0xE4,0xF3,0xCA,0xDD},
+{0x00,0x27,0x4E,0x69,0x9C,0xBB,0xD2,0xF5,0xBF,0x98,0xF1,0xD6,0x23,0x04,0x6D,0x4A},
+{0x00,0x37,0x6E,0x59,0xDC,0xEB,0xB2,0x85,0x3F,0x08,0x51,0x66,0xE3,0xD4,0x8D,0xBA},
+{0x00,0x47,0x8E,0xC9,0x9B,0xDC,0x15,0x52,0xB1,0xF6,0x3F,0x78,0x2A,0x6D,0xA4,0xE3},
+{0x00,0x57,0xAE,0xF9,0xDB,0x8C,0x75,0x22,0x31,0x66,0x9F,0xC8,0xEA,0xBD,0x44,0x13},
+{0x00,0x67,0xCE,0xA9,0x1B,0x7C,0xD5,0xB2,0x36,0x51,0xF8,0x9F,0x2D,0x4A,0xE3,0x84},
+{0x00,0x77,0xEE,0x99,0x5B,0x2C,0xB5,0xC2,0xB6,0xC1,0x58,0x2F,0xED,0x9A,0x03,0x74},
+{0x00,0x89,0x95,0x1C,0xAD,0x24,0x38,0xB1,0xDD,0x54,0x48,0xC1,0x70,0xF9,0xE5,0x6C},
+{0x00,0x99,0xB5,0x2C,0xED,0x74,0x58,0xC1,0x5D,0xC4,0xE8,0x71,0xB0,0x29,0x05,0x9C},
+{0x00,0xA9,0xD5,0x7C,0x2D,0x84,0xF8,0x51,0x5A,0xF3,0x8F,0x26,0x77,0xDE,0xA2,0x0B},
+{0x00,0xB9,0xF5,0x4C,0x6D,0xD4,0x98,0x21,0xDA,0x63,0x2F,0x96,0xB7,0x0E,0x42,0xFB},
+{0x00,0xC9,0x15,0xDC,0x2A,0xE3,0x3F,0xF6,0x54,0x9D,0x41,0x88,0x7E,0xB7,0x6B,0xA2},
+{0x00,0xD9,0x35,0xEC,0x6A,0xB3,0x5F,0x86,0xD4,0x0D,0xE1,0x38,0xBE,0x67,0x8B,0x52},
+{0x00,0xE9,0x55,0xBC,0xAA,0x43,0xFF,0x16,0xD3,0x3A,0x86,0x6F,0x79,0x90,0x2C,0xC5},
+{0x00,0xF9,0x75,0x8C,0xEA,0x13,0x9F,0x66,0x53,0xAA,0x26,0xDF,0xB9,0x40,0xCC,0x35},
+{0x00,0x09,0x12,0x1B,0x24,0x2D,0x36,0x3F,0x48,0x41,0x5A,0x53,0x6C,0x65,0x7E,0x77},
+{0x00,0x19,0x32,0x2B,0x64,0x7D,0x56,0x4F,0xC8,0xD1,0xFA,0xE3,0xAC,0xB5,0x9E,0x87},
+{0x00,0x29,0x52,0x7B,0xA4,0x8D,0xF6,0xDF,0xCF,0xE6,0x9D,0xB4,0x6B,0x42,0x39,0x10},
+{0x00,0x39,0x72,0x4B,0xE4,0xDD,0x96,0xAF,0x4F,0x76,0x3D,0x04,0xAB,0x92,0xD9,0xE0},
+{0x00,0x49,0x92,0xDB,0xA3,0xEA,0x31,0x78,0xC1,0x88,0x53,0x1A,0x62,0x2B,0xF0,0xB9},
+{0x00,0x59,0xB2,0xEB,0xE3,0xBA,0x51,0x08,0x41,0x18,0xF3,0xAA,0xA2,0xFB,0x10,0x49},
+{0x00,0x69,0xD2,0xBB,0x23,0x4A,0xF1,0x98,0x46,0x2F,0x94,0xFD,0x65,0x0C,0xB7,0xDE},
+{0x00,0x79,0xF2,0x8B,0x63,0x1A,0x91,0xE8,0xC6,0xBF,0x34,0x4D,0xA5,0xDC,0x57,0x2E},
+{0x00,0x0E,0x1C,0x12,0x38,0x36,0x24,0x2A,0x70,0x7E,0x6C,0x62,0x48,0x46,0x54,0x5A},
+{0x00,0x1E,0x3C,0x22,0x78,0x66,0x44,0x5A,0xF0,0xEE,0xCC,0xD2,0x88,0x96,0xB4,0xAA},
+{0x00,0x2E,0x5C,0x72,0xB8,0x96,0xE4,0xCA,0xF7,0xD9,0xAB,0x85,0x4F,0x61,0x13,0x3D},
+{0x00,0x3E,0x7C,0x42,0xF8,0xC6,0x84,0xBA,0x77,0x49,0x0B,0x35,0x8F,0xB1,0xF3,0xCD},
+{0x00,0x4E,0x9C,0xD2,0xBF,0xF1,0x23,0x6D,0xF9,0xB7,0x65,0x2B,0x46,0x08,0xDA,0x94},
+{0x00,0x5E,0xBC,0xE2,0xFF,0xA1,0x43,0x1D,0x79,0x27,0xC5,0x9B,0x86,0xD8,0x3A,0x64},
+{0x00,0x6E,0xDC,0xB2,0x3F,0x51,0xE3,0x8D,0x7E,0x10,0xA2,0xCC,0x41,0x2F,0x9D,0xF3},
+{0x00,0x7E,0xFC,0x82,0x7F,0x01,0x83,0xFD,0xFE,0x80,0x02,0x7C,0x81,0xFF,0x7D,0x03},
+{0x00,0x8E,0x9B,0x15,0xB1,0x3F,0x2A,0xA4,0xE5,0x6B,0x7E,0xF0,0x54,0xDA,0xCF,0x41},
+{0x00,0x9E,0xBB,0x25,0xF1,0x6F,0x4A,0xD4,0x65,0xFB,0xDE,0x40,0x94,0x0A,0x2F,0xB1},
+{0x00,0xAE,0xDB,0x75,0x31,0x9F,0xEA,0x44,0x62,0xCC,0xB9,0x17,0x53,0xFD,0x88,0x26},
+{0x00,0xBE,0xFB,0x45,0x71,0xCF,0x8A,0x34,0xE2,0x5C,0x19,0xA7,0x93,0x2D,0x68,0xD6},
+{0x00,0xCE,0x1B,0xD5,0x36,0xF8,0x2D,0xE3,0x6C,0xA2,0x77,0xB9,0x5A,0x94,0x41,0x8F},
+{0x00,0xDE,0x3B,0xE5,0x76,0xA8,0x4D,0x93,0xEC,0x32,0xD7,0x09,0x9A,0x44,0xA1,0x7F},
+{0x00,0xEE,0x5B,0xB5,0xB6,0x58,0xED,0x03,0xEB,0x05,0xB0,0x5E,0x5D,0xB3,0x06,0xE8},
+{0x00,0xFE,0x7B,0x85,0xF6,0x08,0x8D,0x73,0x6B,0x95,0x10,0xEE,0x9D,0x63,0xE6,0x18},
+{0x00,0x95,0xAD,0x38,0xDD,0x48,0x70,0xE5,0x3D,0xA8,0x90,0x05,0xE0,0x75,0x4D,0xD8},
+{0x00,0x85,0x8D,0x08,0x9D,0x18,0x10,0x95,0xBD,0x38,0x30,0xB5,0x20,0xA5,0xAD,0x28},
+{0x00,0xB5,0xED,0x58,0x5D,0xE8,0xB0,0x05,0xBA,0x0F,0x57,0xE2,0xE7,0x52,0x0A,0xBF},
+{0x00,0xA5,0xCD,0x68,0x1D,0xB8,0xD0,0x75,0x3A,0x9F,0xF7,0x52,0x27,0x82,0xEA,0x4F},
+{0x00,0xD5,0x2D,0xF8,0x5A,0x8F,0x77,0xA2,0xB4,0x61,0x99,0x4C,0xEE,0x3B,0xC3,0x16},
+{0x00,0xC5,0x0D,0xC8,0x1A,0xDF,0x17,0xD2,0x34,0xF1,0x39,0xFC,0x2E,0xEB,0x23,0xE6},
+{0x00,0xF5,0x6D,0x98,0xDA,0x2F,0xB7,0x42,0x33,0xC6,0x5E,0xAB,0xE9,0x1C,0x84,0x71},
+{0x00,0xE5,0x4D,0xA8,0x9A,0x7F,0xD7,0x32,0xB3,0x56,0xFE,0x1B,0x29,0xCC,0x64,0x81},
+{0x00,0x15,0x2A,0x3F,0x54,0x41,0x7E,0x6B,0xA8,0xBD,0x82,0x97,0xFC,0xE9,0xD6,0xC3},
+{0x00,0x05,0x0A,0x0F,0x14,0x11,0x1E,0x1B,0x28,0x2D,0x22,0x27,0x3C,0x39,0x36,0x33},
+{0x00,0x35,0x6A,0x5F,0xD4,0xE1,0xBE,0x8B,0x2F,0x1A,0x45,0x70,0xFB,0xCE,0x91,0xA4},
+{0x00,0x25,0x4A,0x6F,0x94,0xB1,0xDE,0xFB,0xAF,0x8A,0xE5,0xC0,0x3B,0x1E,0x71,0x54},
+{0x00,0x55,0xAA,0xFF,0xD3,0x86,0x79,0x2C,0x21,0x74,0x8B,0xDE,0xF2,0xA7,0x58,0x0D},
+{0x00,0x45,0x8A,0xCF,0x93,0xD6,0x19,0x5C,0xA1,0xE4,0x2B,0x6E,0x32,0x77,0xB8,0xFD},
+{0x00,0x75,0xEA,0x9F,0x53,0x26,0xB9,0xCC,0xA6,0xD3,0x4C,0x39,0xF5,0x80,0x1F,0x6A},
+{0x00,0x65,0xCA,0xAF,0x13,0x76,0xD9,0xBC,0x26,0x43,0xEC,0x89,0x35,0x50,0xFF,0x9A},
+{0x00,0x12,0x24,0x36,0x48,0x5A,0x6C,0x7E,0x90,0x82,0xB4,0xA6,0xD8,0xCA,0xFC,0xEE},
+{0x00,0x02,0x04,0x06,0x08,0x0A,0x0C,0x0E,0x10,0x12,0x14,0x16,0x18,0x1A,0x1C,0x1E},
+{0x00,0x32,0x64,0x56,0xC8,0xFA,0xAC,0x9E,0x17,0x25,0x73,0x41,0xDF,0xED,0xBB,0x89},
+{0x00,0x22,0x44,0x66,0x88,0xAA,0xCC,0xEE,0x97,0xB5,0xD3,0xF1,0x1F,0x3D,0x5B,0x79},
+{0x00,0x52,0xA4,0xF6,0xCF,0x9D,0x6B,0x39,0x19,0x4B,0xBD,0xEF,0xD6,0x84,0x72,0x20},
+{0x00,0x42,0x84,0xC6,0x8F,0xCD,0x0B,0x49,0x99,0xDB,0x1D,0x5F,0x16,0x54,0x92,0xD0},
+{0x00,0x72,0xE4,0x96,0x4F,0x3D,0xAB,0xD9,0x9E,0xEC,0x7A,0x08,0xD1,0xA3,0x35,0x47},
+{0x00,0x62,0xC4,0xA6,0x0F,0x6D,0xCB,0xA9,0x1E,0x7C,0xDA,0xB8,0x11,0x73,0xD5,0xB7},
+{0x00,0x92,0xA3,0x31,0xC1,0x53,0x62,0xF0,0x05,0x97,0xA6,0x34,0xC4,0x56,0x67,0xF5},
+{0x00,0x82,0x83,0x01,0x81,0x03,0x02,0x80,0x85,0x07,0x06,0x84,0x04,0x86,0x87,0x05},
+{0x00,0xB2,0xE3,0x51,0x41,0xF3,0xA2,0x10,0x82,0x30,0x61,0xD3,0xC3,0x71,0x20,0x92},
+{0x00,0xA2,0xC3,0x61,0x01,0xA3,0xC2,0x60,0x02,0xA0,0xC1,0x63,0x03,0xA1,0xC0,0x62},
+{0x00,0xD2,0x23,0xF1,0x46,0x94,0x65,0xB7,0x8C,0x5E,0xAF,0x7D,0xCA,0x18,0xE9,0x3B},
+{0x00,0xC2,0x03,0xC1,0x06,0xC4,0x05,0xC7,0x0C,0xCE,0x0F,0xCD,0x0A,0xC8,0x09,0xCB},
+{0x00,0xF2,0x63,0x91,0xC6,0x34,0xA5,0x57,0x0B,0xF9,0x68,0x9A,0xCD,0x3F,0xAE,0x5C},
+{0x00,0xE2,0x43,0xA1,0x86,0x64,0xC5,0x27,0x8B,0x69,0xC8,0x2A,0x0D,0xEF,0x4E,0xAC},
+{0x00,0x1C,0x38,0x24,0x70,0x6C,0x48,0x54,0xE0,0xFC,0xD8,0xC4,0x90,0x8C,0xA8,0xB4},
+{0x00,0x0C,0x18,0x14,0x30,0x3C,0x28,0x24,0x60,0x6C,0x78,0x74,0x50,0x5C,0x48,0x44},
+{0x00,0x3C,0x78,0x44,0xF0,0xCC,0x88,0xB4,0x67,0x5B,0x1F,0x23,0x97,0xAB,0xEF,0xD3},
+{0x00,0x2C,0x58,0x74,0xB0,0x9C,0xE8,0xC4,0xE7,0xCB,0xBF,0x93,0x57,0x7B,0x0F,0x23},
+{0x00,0x5C,0xB8,0xE4,0xF7,0xAB,0x4F,0x13,0x69,0x35,0xD1,0x8D,0x9E,0xC2,0x26,0x7A},
+{0x00,0x4C,0x98,0xD4,0xB7,0xFB,0x2F,0x63,0xE9,0xA5,0x71,0x3D,0x5E,0x12,0xC6,0x8A},
+{0x00,0x7C,0xF8,0x84,0x77,0x0B,0x8F,0xF3,0xEE,0x92,0x16,0x6A,0x99,0xE5,0x61,0x1D},
+{0x00,0x6C,0xD8,0xB4,0x37,0x5B,0xEF,0x83,0x6E,0x02,0xB6,0xDA,0x59,0x35,0x81,0xED},
+{0x00,0x9C,0xBF,0x23,0xF9,0x65,0x46,0xDA,0x75,0xE9,0xCA,0x56,0x8C,0x10,0x33,0xAF},
+{0x00,0x8C,0x9F,0x13,0xB9,0x35,0x26,0xAA,0xF5,0x79,0x6A,0xE6,0x4C,0xC0,0xD3,0x5F},
+{0x00,0xBC,0xFF,0x43,0x79,0xC5,0x86,0x3A,0xF2,0x4E,0x0D,0xB1,0x8B,0x37,0x74,0xC8},
+{0x00,0xAC,0xDF,0x73,0x39,0x95,0xE6,0x4A,0x72,0xDE,0xAD,0x01,0x4B,0xE7,0x94,0x38},
+{0x00,0xDC,0x3F,0xE3,0x7E,0xA2,0x41,0x9D,0xFC,0x20,0xC3,0x1F,0x82,0x5E,0xBD,0x61},
+{0x00,0xCC,0x1F,0xD3,0x3E,0xF2,0x21,0xED,0x7C,0xB0,0x63,0xAF,0x42,0x8E,0x5D,0x91},
+{0x00,0xFC,0x7F,0x83,0xFE,0x02,0x81,0x7D,0x7B,0x87,0x04,0xF8,0x85,0x79,0xFA,0x06},
+{0x00,0xEC,0x5F,0xB3,0xBE,0x52,0xE1,0x0D,0xFB,0x17,0xA4,0x48,0x45,0xA9,0x1A,0xF6},
+{0x00,0x9B,0xB1,0x2A,0xE5,0x7E,0x54,0xCF,0x4D,0xD6,0xFC,0x67,0xA8,0x33,0x19,0x82},
+{0x00,0x8B,0x91,0x1A,0xA5,0x2E,0x34,0xBF,0xCD,0x46,0x5C,0xD7,0x68,0xE3,0xF9,0x72},
+{0x00,0xBB,0xF1,0x4A,0x65,0xDE,0x94,0x2F,0xCA,0x71,0x3B,0x80,0xAF,0x14,0x5E,0xE5},
+{0x00,0xAB,0xD1,0x7A,0x25,0x8E,0xF4,0x5F,0x4A,0xE1,0x9B,0x30,0x6F,0xC4,0xBE,0x15},
+{0x00,0xDB,0x31,0xEA,0x62,0xB9,0x53,0x88,0xC4,0x1F,0xF5,0x2E,0xA6,0x7D,0x97,0x4C},
+{0x00,0xCB,0x11,0xDA,0x22,0xE9,0x33,0xF8,0x44,0x8F,0x55,0x9E,0x66,0xAD,0x77,0xBC},
+{0x00,0xFB,0x71,0x8A,0xE2,0x19,0x93,0x68,0x43,0xB8,0x32,0xC9,0xA1,0x5A,0xD0,0x2B},
+{0x00,0xEB,0x51,0xBA,0xA2,0x49,0xF3,0x18,0xC3,0x28,0x92,0x79,0x61,0x8A,0x30,0xDB},
+{0x00,0x1B,0x36,0x2D,0x6C,0x77,0x5A,0x41,0xD8,0xC3,0xEE,0xF5,0xB4,0xAF,0x82,0x99},
+{0x00,0x0B,0x16,0x1D,0x2C,0x27,0x3A,0x31,0x58,0x53,0x4E,0x45,0x74,0x7F,0x62,0x69},
+{0x00,0x3B,0x76,0x4D,0xEC,0xD7,0x9A,0xA1,0x5F,0x64,0x29,0x12,0xB3,0x88,0xC5,0xFE},
+{0x00,0x2B,0x56,0x7D,0xAC,0x87,0xFA,0xD1,0xDF,0xF4,0x89,0xA2,0x73,0x58,0x25,0x0E},
+{0x00,0x5B,0xB6,0xED,0xEB,0xB0,0x5D,0x06,0x51,0x0A,0xE7,0xBC,0xBA,0xE1,0x0C,0x57},
+{0x00,0x4B,0x96,0xDD,0xAB,0xE0,0x3D,0x76,0xD1,0x9A,0x47,0x0C,0x7A,0x31,0xEC,0xA7},
+{0x00,0x7B,0xF6,0x8D,0x6B,0x10,0x9D,0xE6,0xD6,0xAD,0x20,0x5B,0xBD,0xC6,0x4B,0x30},
+{0x00,0x6B,0xD6,0xBD,0x2B,0x40,0xFD,0x96,0x56,0x3D,0x80,0xEB,0x7D,0x16,0xAB,0xC0},
+{0x00,0xAD,0xDD,0x70,0x3D,0x90,0xE0,0x4D,0x7A,0xD7,0xA7,0x0A,0x47,0xEA,0x9A,0x37},
+{0x00,0xBD,0xFD,0x40,0x7D,0xC0,0x80,0x3D,0xFA,0x47,0x07,0xBA,0x87,0x3A,0x7A,0xC7},
+{0x00,0x8D,0x9D,0x10,0xBD,0x30,0x20,0xAD,0xFD,0x70,0x60,0xED,0x40,0xCD,0xDD,0x50},
+{0x00,0x9D,0xBD,0x20,0xFD,0x60,0x40,0xDD,0x7D,0xE0,0xC0,0x5D,0x80,0x1D,0x3D,0xA0},
+{0x00,0xED,0x5D,0xB0,0xBA,0x57,0xE7,0x0A,0xF3,0x1E,0xAE,0x43,0x49,0xA4,0x14,0xF9},
+{0x00,0xFD,0x7D,0x80,0xFA,0x07,0x87,0x7A,0x73,0x8E,0x0E,0xF3,0x89,0x74,0xF4,0x09},
+{0x00,0xCD,0x1D,0xD0,0x3A,0xF7,0x27,0xEA,0x74,0xB9,0x69,0xA4,0x4E,0x83,0x53,0x9E},
+{0x00,0xDD,0x3D,0xE0,0x7A,0xA7,0x47,0x9A,0xF4,0x29,0xC9,0x14,0x8E,0x53,0xB3,0x6E},
+{0x00,0x2D,0x5A,0x77,0xB4,0x99,0xEE,0xC3,0xEF,0xC2,0xB5,0x98,0x5B,0x76,0x01,0x2C},
+{0x00,0x3D,0x7A,0x47,0xF4,0xC9,0x8E,0xB3,0x6F,0x52,0x15,0x28,0x9B,0xA6,0xE1,0xDC},
+{0x00,0x0D,0x1A,0x17,0x34,0x39,0x2E,0x23,0x68,0x65,0x72,0x7F,0x5C,0x51,0x46,0x4B},
+{0x00,0x1D,0x3A,0x27,0x74,0x69,0x4E,0x53,0xE8,0xF5,0xD2,0xCF,0x9C,0x81,0xA6,0xBB},
+{0x00,0x6D,0xDA,0xB7,0x33,0x5E,0xE9,0x84,0x66,0x0B,0xBC,0xD1,0x55,0x38,0x8F,0xE2},
+{0x00,0x7D,0xFA,0x87,0x73,0x0E,0x89,0xF4,0xE6,0x9B,0x1C,0x61,0x95,0xE8,0x6F,0x12},
+{0x00,0x4D,0x9A,0xD7,0xB3,0xFE,0x29,0x64,0xE1,0xAC,0x7B,0x36,0x52,0x1F,0xC8,0x85},
+{0x00,0x5D,0xBA,0xE7,0xF3,0xAE,0x49,0x14,0x61,0x3C,0xDB,0x86,0x92,0xCF,0x28,0x75},
+{0x00,0x2A,0x54,0x7E,0xA8,0x82,0xFC,0xD6,0xD7,0xFD,0x83,0xA9,0x7F,0x55,0x2B,0x01},
+{0x00,0x3A,0x74,0x4E,0xE8,0xD2,0x9C,0xA6,0x57,0x6D,0x23,0x19,0xBF,0x85,0xCB,0xF1},
+{0x00,0x0A,0x14,0x1E,0x28,0x22,0x3C,0x36,0x50,0x5A,0x44,0x4E,0x78,0x72,0x6C,0x66},
+{0x00,0x1A,0x34,0x2E,0x68,0x72,0x5C,0x46,0xD0,0xCA,0xE4,0xFE,0xB8,0xA2,0x8C,0x96},
+{0x00,0x6A,0xD4,0xBE,0x2F,0x45,0xFB,0x91,0x5E,0x34,0x8A,0xE0,0x71,0x1B,0xA5,0xCF},
+{0x00,0x7A,0xF4,0x8E,0x6F,0x15,0x9B,0xE1,0xDE,0xA4,0x2A,0x50,0xB1,0xCB,0x45,0x3F},
+{0x00,0x4A,0x94,0xDE,0xAF,0xE5,0x3B,0x71,0xD9,0x93,0x4D,0x07,0x76,0x3C,0xE2,0xA8},
+{0x00,0x5A,0xB4,0xEE,0xEF,0xB5,0x5B,0x01,0x59,0x03,0xED,0xB7,0xB6,0xEC,0x02,0x58},
+{0x00,0xAA,0xD3,0x79,0x21,0x8B,0xF2,0x58,0x42,0xE8,0x91,0x3B,0x63,0xC9,0xB0,0x1A},
+{0x00,0xBA,0xF3,0x49,0x61,0xDB,0x92,0x28,0xC2,0x78,0x31,0x8B,0xA3,0x19,0x50,0xEA},
+{0x00,0x8A,0x93,0x19,0xA1,0x2B,0x32,0xB8,0xC5,0x4F,0x56,0xDC,0x64,0xEE,0xF7,0x7D},
+{0x00,0x9A,0xB3,0x29,0xE1,0x7B,0x52,0xC8,0x45,0xDF,0xF6,0x6C,0xA4,0x3E,0x17,0x8D},
+{0x00,0xEA,0x53,0xB9,0xA6,0x4C,0xF5,0x1F,0xCB,0x21,0x98,0x72,0x6D,0x87,0x3E,0xD4},
+{0x00,0xFA,0x73,0x89,0xE6,0x1C,0x95,0x6F,0x4B,0xB1,0x38,0xC2,0xAD,0x57,0xDE,0x24},
+{0x00,0xCA,0x13,0xD9,0x26,0xEC,0x35,0xFF,0x4C,0x86,0x5F,0x95,0x6A,0xA0,0x79,0xB3},
+{0x00,0xDA,0x33,0xE9,0x66,0xBC,0x55,0x8F,0xCC,0x16,0xFF,0x25,0xAA,0x70,0x99,0x43},
+{0x00,0x24,0x48,0x6C,0x90,0xB4,0xD8,0xFC,0xA7,0x83,0xEF,0xCB,0x37,0x13,0x7F,0x5B},
+{0x00,0x34,0x68,0x5C,0xD0,0xE4,0xB8,0x8C,0x27,0x13,0x4F,0x7B,0xF7,0xC3,0x9F,0xAB},
+{0x00,0x04,0x08,0x0C,0x10,0x14,0x18,0x1C,0x20,0x24,0x28,0x2C,0x30,0x34,0x38,0x3C},
+{0x00,0x14,0x28,0x3C,0x50,0x44,0x78,0x6C,0xA0,0xB4,0x88,0x9C,0xF0,0xE4,0xD8,0xCC},
+{0x00,0x64,0xC8,0xAC,0x17,0x73,0xDF,0xBB,0x2E,0x4A,0xE6,0x82,0x39,0x5D,0xF1,0x95},
+{0x00,0x74,0xE8,0x9C,0x57,0x23,0xBF,0xCB,0xAE,0xDA,0x46,0x32,0xF9,0x8D,0x11,0x65},
+{0x00,0x44,0x88,0xCC,0x97,0xD3,0x1F,0x5B,0xA9,0xED,0x21,0x65,0x3E,0x7A,0xB6,0xF2},
+{0x00,0x54,0xA8,0xFC,0xD7,0x83,0x7F,0x2B,0x29,0x7D,0x81,0xD5,0xFE,0xAA,0x56,0x02},
+{0x00,0xA4,0xCF,0x6B,0x19,0xBD,0xD6,0x72,0x32,0x96,0xFD,0x59,0x2B,0x8F,0xE4,0x40},
+{0x00,0xB4,0xEF,0x5B,0x59,0xED,0xB6,0x02,0xB2,0x06,0x5D,0xE9,0xEB,0x5F,0x04,0xB0},
+{0x00,0x84,0x8F,0x0B,0x99,0x1D,0x16,0x92,0xB5,0x31,0x3A,0xBE,0x2C,0xA8,0xA3,0x27},
+{0x00,0x94,0xAF,0x3B,0xD9,0x4D,0x76,0xE2,0x35,0xA1,0x9A,0x0E,0xEC,0x78,0x43,0xD7},
+{0x00,0xE4,0x4F,0xAB,0x9E,0x7A,0xD1,0x35,0xBB,0x5F,0xF4,0x10,0x25,0xC1,0x6A,0x8E},
+{0x00,0xF4,0x6F,0x9B,0xDE,0x2A,0xB1,0x45,0x3B,0xCF,0x54,0xA0,0xE5,0x11,0x8A,0x7E},
+{0x00,0xC4,0x0F,0xCB,0x1E,0xDA,0x11,0xD5,0x3C,0xF8,0x33,0xF7,0x22,0xE6,0x2D,0xE9},
+{0x00,0xD4,0x2F,0xFB,0x5E,0x8A,0x71,0xA5,0xBC,0x68,0x93,0x47,0xE2,0x36,0xCD,0x19},
+{0x00,0xA3,0xC1,0x62,0x05,0xA6,0xC4,0x67,0x0A,0xA9,0xCB,0x68,0x0F,0xAC,0xCE,0x6D},
+{0x00,0xB3,0xE1,0x52,0x45,0xF6,0xA4,0x17,0x8A,0x39,0x6B,0xD8,0xCF,0x7C,0x2E,0x9D},
+{0x00,0x83,0x81,0x02,0x85,0x06,0x04,0x87,0x8D,0x0E,0x0C,0x8F,0x08,0x8B,0x89,0x0A},
+{0x00,0x93,0xA1,0x32,0xC5,0x56,0x64,0xF7,0x0D,0x9E,0xAC,0x3F,0xC8,0x5B,0x69,0xFA},
+{0x00,0xE3,0x41,0xA2,0x82,0x61,0xC3,0x20,0x83,0x60,0xC2,0x21,0x01,0xE2,0x40,0xA3},
+{0x00,0xF3,0x61,0x92,0xC2,0x31,0xA3,0x50,0x03,0xF0,0x62,0x91,0xC1,0x32,0xA0,0x53},
+{0x00,0xC3,0x01,0xC2,0x02,0xC1,0x03,0xC0,0x04,0xC7,0x05,0xC6,0x06,0xC5,0x07,0xC4},
+{0x00,0xD3,0x21,0xF2,0x42,0x91,0x63,0xB0,0x84,0x57,0xA5,0x76,0xC6,0x15,0xE7,0x34},
+{0x00,0x23,0x46,0x65,0x8C,0xAF,0xCA,0xE9,0x9F,0xBC,0xD9,0xFA,0x13,0x30,0x55,0x76},
+{0x00,0x33,0x66,0x55,0xCC,0xFF,0xAA,0x99,0x1F,0x2C,0x79,0x4A,0xD3,0xE0,0xB5,0x86},
+{0x00,0x03,0x06,0x05,0x0C,0x0F,0x0A,0x09,0x18,0x1B,0x1E,0x1D,0x14,0x17,0x12,0x11},
+{0x00,0x13,0x26,0x35,0x4C,0x5F,0x6A,0x79,0x98,0x8B,0xBE,0xAD,0xD4,0xC7,0xF2,0xE1},
+{0x00,0x63,0xC6,0xA5,0x0B,0x68,0xCD,0xAE,0x16,0x75,0xD0,0xB3,0x1D,0x7E,0xDB,0xB8},
+{0x00,0x73,0xE6,0x95,0x4B,0x38,0xAD,0xDE,0x96,0xE5,0x70,0x03,0xDD,0xAE,0x3B,0x48},
+{0x00,0x43,0x86,0xC5,0x8B,0xC8,0x0D,0x4E,0x91,0xD2,0x17,0x54,0x1A,0x59,0x9C,0xDF},
+{0x00,0x53,0xA6,0xF5,0xCB,0x98,0x6D,0x3E,0x11,0x42,0xB7,0xE4,0xDA,0x89,0x7C,0x2F},
+{0x00,0x38,0x70,0x48,0xE0,0xD8,0x90,0xA8,0x47,0x7F,0x37,0x0F,0xA7,0x9F,0xD7,0xEF},
+{0x00,0x28,0x50,0x78,0xA0,0x88,0xF0,0xD8,0xC7,0xEF,0x97,0xBF,0x67,0x4F,0x37,0x1F},
+{0x00,0x18,0x30,0x28,0x60,0x78,0x50,0x48,0xC0,0xD8,0xF0,0xE8,0xA0,0xB8,0x90,0x88},
+{0x00,0x08,0x10,0x18,0x20,0x28,0x30,0x38,0x40,0x48,0x50,0x58,0x60,0x68,0x70,0x78},
+{0x00,0x78,0xF0,0x88,0x67,0x1F,0x97,0xEF,0xCE,0xB6,0x3E,0x46,0xA9,0xD1,0x59,0x21},
+{0x00,0x68,0xD0,0xB8,0x27,0x4F,0xF7,0x9F,0x4E,0x26,0x9E,0xF6,0x69,0x01,0xB9,0xD1},
+{0x00,0x58,0xB0,0xE8,0xE7,0xBF,0x57,0x0F,0x49,0x11,0xF9,0xA1,0xAE,0xF6,0x1E,0x46},
+{0x00,0x48,0x90,0xD8,0xA7,0xEF,0x37,0x7F,0xC9,0x81,0x59,0x11,0x6E,0x26,0xFE,0xB6},
+{0x00,0xB8,0xF7,0x4F,0x69,0xD1,0x9E,0x26,0xD2,0x6A,0x25,0x9D,0xBB,0x03,0x4C,0xF4},
+{0x00,0xA8,0xD7,0x7F,0x29,0x81,0xFE,0x56,0x52,0xFA,0x85,0x2D,0x7B,0xD3,0xAC,0x04},
+{0x00,0x98,0xB7,0x2F,0xE9,0x71,0x5E,0xC6,0x55,0xCD,0xE2,0x7A,0xBC,0x24,0x0B,0x93},
+{0x00,0x88,0x97,0x1F,0xA9,0x21,0x3E,0xB6,0xD5,0x5D,0x42,0xCA,0x7C,0xF4,0xEB,0x63},
+{0x00,0xF8,0x77,0x8F,0xEE,0x16,0x99,0x61,0x5B,0xA3,0x2C,0xD4,0xB5,0x4D,0xC2,0x3A},
+{0x00,0xE8,0x57,0xBF,0xAE,0x46,0xF9,0x11,0xDB,0x33,0x8C,0x64,0x75,0x9D,0x22,0xCA},
+{0x00,0xD8,0x37,0xEF,0x6E,0xB6,0x59,0x81,0xDC,0x04,0xEB,0x33,0xB2,0x6A,0x85,0x5D},
+{0x00,0xC8,0x17,0xDF,0x2E,0xE6,0x39,0xF1,0x5C,0x94,0x4B,0x83,0x72,0xBA,0x65,0xAD},
+{0x00,0xBF,0xF9,0x46,0x75,0xCA,0x8C,0x33,0xEA,0x55,0x13,0xAC,0x9F,0x20,0x66,0xD9},
+{0x00,0xAF,0xD9,0x76,0x35,0x9A,0xEC,0x43,0x6A,0xC5,0xB3,0x1C,0x5F,0xF0,0x86,0x29},
+{0x00,0x9F,0xB9,0x26,0xF5,0x6A,0x4C,0xD3,0x6D,0xF2,0xD4,0x4B,0x98,0x07,0x21,0xBE},
+{0x00,0x8F,0x99,0x16,0xB5,0x3A,0x2C,0xA3,0xED,0x62,0x74,0xFB,0x58,0xD7,0xC1,0x4E},
+{0x00,0xFF,0x79,0x86,0xF2,0x0D,0x8B,0x74,0x63,0x9C,0x1A,0xE5,0x91,0x6E,0xE8,0x17},
+{0x00,0xEF,0x59,0xB6,0xB2,0x5D,0xEB,0x04,0xE3,0x0C,0xBA,0x55,0x51,0xBE,0x08,0xE7},
+{0x00,0xDF,0x39,0xE6,0x72,0xAD,0x4B,0x94,0xE4,0x3B,0xDD,0x02,0x96,0x49,0xAF,0x70},
+{0x00,0xCF,0x19,0xD6,0x32,0xFD,0x2B,0xE4,0x64,0xAB,0x7D,0xB2,0x56,0x99,0x4F,0x80},
+{0x00,0x3F,0x7E,0x41,0xFC,0xC3,0x82,0xBD,0x7F,0x40,0x01,0x3E,0x83,0xBC,0xFD,0xC2},
+{0x00,0x2F,0x5E,0x71,0xBC,0x93,0xE2,0xCD,0xFF,0xD0,0xA1,0x8E,0x43,0x6C,0x1D,0x32},
+{0x00,0x1F,0x3E,0x21,0x7C,0x63,0x42,0x5D,0xF8,0xE7,0xC6,0xD9,0x84,0x9B,0xBA,0xA5},
+{0x00,0x0F,0x1E,0x11,0x3C,0x33,0x22,0x2D,0x78,0x77,0x66,0x69,0x44,0x4B,0x5A,0x55},
+{0x00,0x7F,0xFE,0x81,0x7B,0x04,0x85,0xFA,0xF6,0x89,0x08,0x77,0x8D,0xF2,0x73,0x0C},
+{0x00,0x6F,0xDE,0xB1,0x3B,0x54,0xE5,0x8A,0x76,0x19,0xA8,0xC7,0x4D,0x22,0x93,0xFC},
+{0x00,0x5F,0xBE,0xE1,0xFB,0xA4,0x45,0x1A,0x71,0x2E,0xCF,0x90,0x8A,0xD5,0x34,0x6B},
+{0x00,0x4F,0x9E,0xD1,0xBB,0xF4,0x25,0x6A,0xF1,0xBE,0x6F,0x20,0x4A,0x05,0xD4,0x9B},
+{0x00,0xB1,0xE5,0x54,0x4D,0xFC,0xA8,0x19,0x9A,0x2B,0x7F,0xCE,0xD7,0x66,0x32,0x83},
+{0x00,0xA1,0xC5,0x64,0x0D,0xAC,0xC8,0x69,0x1A,0xBB,0xDF,0x7E,0x17,0xB6,0xD2,0x73},
+{0x00,0x91,0xA5,0x34,0xCD,0x5C,0x68,0xF9,0x1D,0x8C,0xB8,0x29,0xD0,0x41,0x75,0xE4},
+{0x00,0x81,0x85,0x04,0x8D,0x0C,0x08,0x89,0x9D,0x1C,0x18,0x99,0x10,0x91,0x95,0x14},
+{0x00,0xF1,0x65,0x94,0xCA,0x3B,0xAF,0x5E,0x13,0xE2,0x76,0x87,0xD9,0x28,0xBC,0x4D},
+{0x00,0xE1,0x45,0xA4,0x8A,0x6B,0xCF,0x2E,0x93,0x72,0xD6,0x37,0x19,0xF8,0x5C,0xBD},
+{0x00,0xD1,0x25,0xF4,0x4A,0x9B,0x6F,0xBE,0x94,0x45,0xB1,0x60,0xDE,0x0F,0xFB,0x2A},
+{0x00,0xC1,0x05,0xC4,0x0A,0xCB,0x0F,0xCE,0x14,0xD5,0x11,0xD0,0x1E,0xDF,0x1B,0xDA},
+{0x00,0x31,0x62,0x53,0xC4,0xF5,0xA6,0x97,0x0F,0x3E,0x6D,0x5C,0xCB,0xFA,0xA9,0x98},
+{0x00,0x21,0x42,0x63,0x84,0xA5,0xC6,0xE7,0x8F,0xAE,0xCD,0xEC,0x0B,0x2A,0x49,0x68},
+{0x00,0x11,0x22,0x33,0x44,0x55,0x66,0x77,0x88,0x99,0xAA,0xBB,0xCC,0xDD,0xEE,0xFF},
+{0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0A,0x0B,0x0C,0x0D,0x0E,0x0F},
+{0x00,0x71,0xE2,0x93,0x43,0x32,0xA1,0xD0,0x86,0xF7,0x64,0x15,0xC5,0xB4,0x27,0x56},
+{0x00,0x61,0xC2,0xA3,0x03,0x62,0xC1,0xA0,0x06,0x67,0xC4,0xA5,0x05,0x64,0xC7,0xA6},
+{0x00,0x51,0xA2,0xF3,0xC3,0x92,0x61,0x30,0x01,0x50,0xA3,0xF2,0xC2,0x93,0x60,0x31},
+{0x00,0x41,0x82,0xC3,0x83,0xC2,0x01,0x40,0x81,0xC0,0x03,0x42,0x02,0x43,0x80,0xC1},
+{0x00,0x36,0x6C,0x5A,0xD8,0xEE,0xB4,0x82,0x37,0x01,0x5B,0x6D,0xEF,0xD9,0x83,0xB5},
+{0x00,0x26,0x4C,0x6A,0x98,0xBE,0xD4,0xF2,0xB7,0x91,0xFB,0xDD,0x2F,0x09,0x63,0x45},
+{0x00,0x16,0x2C,0x3A,0x58,0x4E,0x74,0x62,0xB0,0xA6,0x9C,0x8A,0xE8,0xFE,0xC4,0xD2},
+{0x00,0x06,0x0C,0x0A,0x18,0x1E,0x14,0x12,0x30,0x36,0x3C,0x3A,0x28,0x2E,0x24,0x22},
+{0x00,0x76,0xEC,0x9A,0x5F,0x29,0xB3,0xC5,0xBE,0xC8,0x52,0x24,0xE1,0x97,0x0D,0x7B},
+{0x00,0x66,0xCC,0xAA,0x1F,0x79,0xD3,0xB5,0x3E,0x58,0xF2,0x94,0x21,0x47,0xED,0x8B},
+{0x00,0x56,0xAC,0xFA,0xDF,0x89,0x73,0x25,0x39,0x6F,0x95,0xC3,0xE6,0xB0,0x4A,0x1C},
+{0x00,0x46,0x8C,0xCA,0x9F,0xD9,0x13,0x55,0xB9,0xFF,0x35,0x73,0x26,0x60,0xAA,0xEC},
+{0x00,0xB6,0xEB,0x5D,0x51,0xE7,0xBA,0x0C,0xA2,0x14,0x49,0xFF,0xF3,0x45,0x18,0xAE},
+{0x00,0xA6,0xCB,0x6D,0x11,0xB7,0xDA,0x7C,0x22,0x84,0xE9,0x4F,0x33,0x95,0xF8,0x5E},
+{0x00,0x96,0xAB,0x3D,0xD1,0x47,0x7A,0xEC,0x25,0xB3,0x8E,0x18,0xF4,0x62,0x5F,0xC9},
+{0x00,0x86,0x8B,0x0D,0x91,0x17,0x1A,0x9C,0xA5,0x23,0x2E,0xA8,0x34,0xB2,0xBF,0x39},
+{0x00,0xF6,0x6B,0x9D,0xD6,0x20,0xBD,0x4B,0x2B,0xDD,0x40,0xB6,0xFD,0x0B,0x96,0x60},
+{0x00,0xE6,0x4B,0xAD,0x96,0x70,0xDD,0x3B,0xAB,0x4D,0xE0,0x06,0x3D,0xDB,0x76,0x90},
+{0x00,0xD6,0x2B,0xFD,0x56,0x80,0x7D,0xAB,0xAC,0x7A,0x87,0x51,0xFA,0x2C,0xD1,0x07},
+{0x00,0xC6,0x0B,0xCD,0x16,0xD0,0x1D,0xDB,0x2C,0xEA,0x27,0xE1,0x3A,0xFC,0x31,0xF7},
+};
+
+/* The roots of the generator polynomial raised to each power of the
+ * remainder terms, highest power first. Rows are 32 syndromes wide, so
+ * codes with more roots have one block of NROOTS rows per 32 syndromes */
+static const uint8_t SYN_POW8[8][32] = {
+{0x8E,0x2C,0xDD,0x84,0x73,0x1F,0x2B,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x71,0x8F,0x82,0x32,0x3A,0x03,0xFA,0xD2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x2C,0x7C,0x78,0x06,0x41,0xA7,0x95,0x2B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x0C,0x97,0x16,0x46,0xBE,0x56,0x70,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xDD,0x78,0x13,0xE0,0x88,0x35,0xA7,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x6A,0x14,0x32,0x3E,0xAD,0x3A,0xDC,0xCA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x84,0x06,0xE0,0x8A,0x9C,0x88,0x41,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+};
+
+static const uint8_t SYN_POW16[16][32] = {
+{0xFA,0xF1,0x33,0xB4,0xFE,0x17,0xF9,0x78,0xA7,0xE1,0xA5,0x92,0xC0,0xF4,0x2F,0x8F,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xE1,0x76,0x4A,0x4F,0x2E,0xC5,0x71,0x6A,0xCA,0xD2,0xD0,0x91,0xFF,0xB7,0xB9,0xF9,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xF1,0x52,0x07,0x5B,0xEA,0xE2,0x4B,0x3F,0x0A,0x21,0x69,0x9A,0x40,0x5A,0xAE,0x2F,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xA5,0xBD,0x31,0xD1,0xCE,0x2F,0x7E,0x16,0x56,0x05,0xF1,0x24,0x55,0xD7,0xED,0x17,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x33,0x07,0x5C,0xED,0x54,0x4C,0x28,0xAC,0x0B,0x6E,0xAF,0xC4,0xBD,0x8B,0x5A,0xF4,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x92,0x36,0x8D,0xF4,0xC5,0x9F,0x8F,0x14,0xDC,0xFA,0xEC,0xD0,0x33,0xBA,0x09,0xFE,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xB4,0x5B,0xED,0xB0,0x57,0xF9,0x8C,0x13,0x35,0x5F,0xE1,0xA4,0x6B,0xBD,0x40,0xC0,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xC0,0xE7,0x43,0x9B,0x50,0xE8,0x93,0xC9,0x3C,0x4E,0xCF,0x37,0x11,0xF7,0xF6,0xB4,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xFE,0xEA,0x54,0x57,0x8E,0x2C,0xDD,0x84,0x73,0x1F,0x2B,0x22,0xA4,0xC4,0x9A,0x92,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xF4,0x98,0xD5,0x2A,0x71,0x8F,0x82,0x32,0x3A,0x03,0xFA,0xD2,0x0F,0x1C,0x94,0x33,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x17,0xE2,0x4C,0xF9,0x2C,0x7C,0x78,0x06,0x41,0xA7,0x95,0x2B,0xE1,0xAF,0x69,0xA5,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x2F,0xC8,0x3D,0x7E,0x0C,0x97,0x16,0x46,0xBE,0x56,0x70,0xE3,0x05,0xCC,0xCD,0xF1,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xF9,0x4B,0x28,0x8C,0xDD,0x78,0x13,0xE0,0x88,0x35,0xA7,0x1F,0x5F,0x6E,0x21,0xE1,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x8F,0x47,0xBF,0x82,0x6A,0x14,0x32,0x3E,0xAD,0x3A,0xDC,0xCA,0x03,0x45,0x44,0xFA,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x78,0x3F,0xAC,0x13,0x84,0x06,0xE0,0x8A,0x9C,0x88,0x41,0x73,0x35,0x0B,0x0A,0xA7,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+};
+
+static const uint8_t SYN_POW32[32][32] = {
+{0xC1,0x8B,0x9B,0x14,0xCD,0x4D,0xA0,0x74,0xE1,0x12,0xAE,0x93,0x90,0x62,0x0D,0x15,
+ 0x1E,0x68,0xA8,0xF0,0x4E,0x52,0x1B,0xF9,0x19,0xD8,0x53,0xC8,0xDC,0x11,0x5C,0xFC},
+{0x33,0xFE,0xF9,0xA7,0xA5,0xC0,0x2F,0x01,0xF1,0xB4,0x17,0x78,0xE1,0x92,0xF4,0x8F,
+ 0xFA,0x33,0xFE,0xF9,0xA7,0xA5,0xC0,0x2F,0x01,0xF1,0xB4,0x17,0x78,0xE1,0x92,0xF4},
+{0x8B,0xB5,0x82,0xCF,0x91,0xED,0x83,0x19,0xA5,0x5D,0x81,0x32,0xCD,0xBA,0x85,0x64,
+ 0x1D,0xF3,0x8D,0xC8,0x3A,0x61,0x9D,0x17,0x74,0xC2,0xBD,0x2E,0xE8,0x03,0xFD,0x5C},
+{0xE4,0xA1,0x35,0x69,0x8B,0x98,0xBF,0xC6,0x33,0xDB,0x99,0x88,0xC1,0xB6,0xCE,0x0C,
+ 0xE3,0x24,0x20,0xFC,0xE0,0x7D,0x29,0xF4,0xDF,0x45,0x94,0x5C,0xE2,0x13,0x27,0x79},
+{0x9B,0x82,0x05,0x33,0x86,0x39,0xE0,0xB2,0x92,0xF5,0x71,0x56,0x1C,0xB4,0xB0,0x8C,
+ 0x5F,0x6B,0xC0,0xD5,0x16,0xD2,0x3B,0xFE,0x18,0x88,0x63,0xB8,0xF4,0x7E,0x03,0x11},
+{0x83,0x0B,0xA4,0xB6,0x43,0x7E,0x42,0xB3,0xB4,0x5E,0x15,0x1F,0x76,0x36,0x98,0x47,
+ 0x44,0x94,0x09,0xB9,0xDD,0x1E,0xBB,0xC0,0x75,0xE6,0x05,0xF7,0x20,0x57,0xAC,0xC2},
+{0x14,0xCF,0x33,0x20,0xE2,0x78,0x2B,0xAA,0xC0,0xC5,0x97,0xFA,0xF2,0x09,0x17,0x7C,
+ 0x95,0xA5,0x36,0x72,0x8F,0x70,0xD0,0xB4,0xAB,0x2C,0xA7,0x69,0xB6,0xF4,0xE8,0xDC},
+{0x1F,0x51,0x40,0xF4,0x71,0x3A,0x0F,0x6C,0xFE,0x39,0x13,0x21,0xF3,0xC0,0x9B,0x93,
+ 0x4E,0x11,0xB4,0x85,0x4B,0x35,0x63,0x92,0xC7,0x2A,0x32,0xD2,0x33,0x5B,0x08,0xDD},
+{0xCD,0x91,0x86,0xE2,0xFB,0x5F,0x76,0xDE,0xF4,0x3D,0xAD,0x89,0x80,0x20,0x08,0x02,
+ 0xC3,0x51,0xB6,0xEE,0xF8,0x3E,0xCC,0x33,0x6D,0xB9,0x8C,0x23,0x69,0xB8,0x2E,0xC8},
+{0xBB,0x7B,0xCE,0xE8,0xBE,0x89,0xEB,0x6D,0x17,0x15,0x0A,0x63,0x4A,0x8D,0xD5,0xBF,
+ 0x45,0x1C,0xBA,0xB7,0x39,0x3F,0x1E,0xA5,0xDE,0x10,0xF8,0x46,0xCF,0x24,0x49,0x5E},
+{0x4D,0xED,0x39,0x78,0x5F,0x51,0xB8,0xC7,0x2F,0x82,0x4E,0x1C,0x55,0xFE,0x57,0xDD,
+ 0x1F,0xA4,0x92,0xD1,0xD5,0x93,0x03,0xF1,0x6C,0x86,0x08,0x8C,0xA7,0x63,0xBD,0x53},
+{0x8D,0xC5,0x8F,0xDC,0xEC,0x33,0x09,0xAB,0xF9,0x06,0x2B,0xA5,0xB6,0xA8,0x2F,0x97,
+ 0x70,0xF1,0x62,0x20,0x17,0x2C,0x41,0xE1,0xAA,0x36,0xF4,0x9F,0x14,0xFA,0xD0,0xBA},
+{0xA0,0x83,0xE0,0x2B,0x76,0xB8,0xBC,0x75,0x8F,0x3C,0xA2,0x24,0x9D,0xB1,0x39,0xFB,
+ 0x23,0x63,0xCB,0x5D,0xCE,0x04,0xC9,0xFA,0xB3,0x9E,0x86,0xB9,0x2C,0x88,0xC2,0xD8},
+{0xF8,0x16,0x4E,0xF1,0x3B,0xD7,0x85,0x18,0x78,0x1F,0x63,0x68,0x4F,0xF4,0x2A,0x82,
+ 0x03,0x0F,0x33,0xFF,0x0D,0x39,0xDD,0xA7,0xB2,0xF3,0x31,0xF5,0x2F,0x93,0x56,0x89},
+{0x74,0x19,0xB2,0xAA,0xDE,0xC7,0x75,0xDF,0x01,0xC6,0xB3,0x6C,0x6D,0xAB,0x18,0x74,
+ 0x19,0xB2,0xAA,0xDE,0xC7,0x75,0xDF,0x01,0xC6,0xB3,0x6C,0x6D,0xAB,0x18,0x74,0x19},
+{0xCA,0xA2,0x94,0xBA,0x6F,0xB0,0x8E,0x74,0xA7,0x27,0xD8,0xB8,0x5A,0x72,0xF8,0xE6,
+ 0x42,0x89,0xF2,0x07,0x86,0xA0,0xA1,0x78,0x19,0x22,0x6B,0xDA,0x8D,0x98,0x04,0x6A},
+{0xE1,0xA5,0x92,0xC0,0xF4,0x2F,0x8F,0x01,0xFA,0xF1,0x33,0xB4,0xFE,0x17,0xF9,0x78,
+ 0xA7,0xE1,0xA5,0x92,0xC0,0xF4,0x2F,0x8F,0x01,0xFA,0xF1,0x33,0xB4,0xFE,0x17,0xF9},
+{0xFD,0xF6,0xD7,0xB1,0x7A,0x4B,0xAC,0x19,0xE1,0x76,0x4A,0x4F,0x2E,0xC5,0x71,0x6A,
+ 0xCA,0xD2,0xD0,0x91,0xFF,0xB7,0xB9,0xF9,0x74,0x0B,0x21,0x66,0xCB,0x31,0xE7,0xB5},
+{0x12,0x5D,0xF5,0xC5,0x3D,0x82,0x3C,0xC6,0xF1,0x52,0x07,0x5B,0xEA,0xE2,0x4B,0x3F,
+ 0x0A,0x21,0x69,0x9A,0x40,0x5A,0xAE,0x2F,0xDF,0xC9,0x03,0xCC,0xD0,0x3B,0x9D,0x1B},
+{0x5B,0x0D,0x08,0xF9,0xDD,0x88,0x5F,0xB2,0xA5,0xBD,0x31,0xD1,0xCE,0x2F,0x7E,0x16,
+ 0x56,0x05,0xF1,0x24,0x55,0xD7,0xED,0x17,0x18,0x8C,0xE0,0x1F,0xE1,0x51,0x68,0x40},
+{0xAE,0x81,0x71,0x97,0xAD,0x4E,0xA2,0xB3,0x33,0x07,0x5C,0xED,0x54,0x4C,0x28,0xAC,
+ 0x0B,0x6E,0xAF,0xC4,0xBD,0x8B,0x5A,0xF4,0x75,0x04,0x93,0x3E,0x70,0xD2,0x61,0x52},
+{0x4C,0x2C,0x78,0x41,0x95,0xE1,0x69,0xAA,0x92,0x36,0x8D,0xF4,0xC5,0x9F,0x8F,0x14,
+ 0xDC,0xFA,0xEC,0xD0,0x33,0xBA,0x09,0xFE,0xAB,0xE2,0xF9,0x7C,0x06,0xA7,0x2B,0xAF},
+{0x93,0x32,0x56,0xFA,0x89,0x1C,0x24,0x6C,0xB4,0x5B,0xED,0xB0,0x57,0xF9,0x8C,0x13,
+ 0x35,0x5F,0xE1,0xA4,0x6B,0xBD,0x40,0xC0,0xC7,0xCE,0xD5,0xF8,0x8F,0x16,0x3A,0x4E},
+{0x73,0xC3,0x21,0xAF,0x87,0xF3,0x79,0xDE,0xC0,0xE7,0x43,0x9B,0x50,0xE8,0x93,0xC9,
+ 0x3C,0x4E,0xCF,0x37,0x11,0xF7,0xF6,0xB4,0x6D,0xE4,0x85,0x77,0x4C,0x4B,0x02,0x84},
+{0x90,0xCD,0x1C,0xF2,0x80,0x55,0x9D,0x6D,0xFE,0xEA,0x54,0x57,0x8E,0x2C,0xDD,0x84,
+ 0x73,0x1F,0x2B,0x22,0xA4,0xC4,0x9A,0x92,0xDE,0x5D,0xD1,0xEE,0x72,0xD5,0xC8,0xF0},
+{0x51,0x6B,0x68,0x92,0x40,0x4F,0x53,0xC7,0xF4,0x98,0xD5,0x2A,0x71,0x8F,0x82,0x32,
+ 0x3A,0x03,0xFA,0xD2,0x0F,0x1C,0x94,0x33,0x6C,0x4D,0xFF,0x5B,0xFE,0x0D,0xB0,0x08},
+{0x62,0xBA,0xB4,0x09,0x20,0xFE,0xB1,0xAB,0x17,0xE2,0x4C,0xF9,0x2C,0x7C,0x78,0x06,
+ 0x41,0xA7,0x95,0x2B,0xE1,0xAF,0x69,0xA5,0xAA,0xCB,0x92,0xB6,0x36,0xC0,0x8D,0xA8},
+{0xE9,0x1A,0xD1,0xA8,0x10,0xCE,0xB5,0x75,0x2F,0xC8,0x3D,0x7E,0x0C,0x97,0x16,0x46,
+ 0xBE,0x56,0x70,0xE3,0x05,0xCC,0xCD,0xF1,0xB3,0xFD,0x24,0xEB,0x62,0x55,0x34,0x25},
+{0x0D,0x85,0xB0,0x17,0x08,0x57,0x39,0x18,0xF9,0x4B,0x28,0x8C,0xDD,0x78,0x13,0xE0,
+ 0x88,0x35,0xA7,0x1F,0x5F,0x6E,0x21,0xE1,0xB2,0x63,0xA4,0x51,0xA5,0x6B,0xF3,0x68},
+{0x96,0x58,0x2A,0x9F,0x04,0x71,0xF0,0xDF,0x8F,0x47,0xBF,0x82,0x6A,0x14,0x32,0x3E,
+ 0xAD,0x3A,0xDC,0xCA,0x03,0x45,0x44,0xFA,0xC6,0x90,0xD2,0xA2,0xEC,0x0F,0xD6,0xD3},
+{0x15,0x64,0x8C,0x7C,0x02,0xDD,0xFB,0x74,0x78,0x3F,0xAC,0x13,0x84,0x06,0xE0,0x8A,
+ 0x9C,0x88,0x41,0x73,0x35,0x0B,0x0A,0xA7,0x19,0x23,0x1F,0xC3,0x95,0x5F,0x1D,0x1E},
+{0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+ 0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01},
+};
+
+static const uint8_t SYN_POW48[96][32] = {
+{0x52,0x17,0x23,0xDA,0xF8,0xA2,0x20,0xDD,0x76,0x43,0x3A,0x62,0x67,0x6E,0x7B,0xDF,
+ 0xF1,0xB7,0x84,0xF3,0x30,0x70,0x4D,0xA1,0x27,0x53,0x97,0x59,0x85,0x73,0x4A,0x2F},
+{0x5D,0x8F,0xD3,0xB7,0x13,0xBB,0x72,0x56,0xF6,0xFC,0x6E,0x36,0xF0,0x0F,0xDB,0x74,
+ 0xA5,0x43,0xBE,0x3B,0x7A,0x95,0x40,0x04,0xA2,0x5B,0x7C,0x66,0xF5,0x46,0xF7,0x17},
+{0x17,0xA7,0x92,0x2F,0xFA,0xB4,0xF9,0xE1,0xC0,0x8F,0xF1,0xFE,0x78,0xA5,0xF4,0x01,
+ 0x33,0x17,0xA7,0x92,0x2F,0xFA,0xB4,0xF9,0xE1,0xC0,0x8F,0xF1,0xFE,0x78,0xA5,0xF4},
+{0x0C,0xF1,0x1B,0xFB,0x51,0x2E,0x14,0x94,0x2D,0x8A,0xF3,0x72,0x3C,0x3B,0x77,0x19,
+ 0x92,0x96,0x44,0x4D,0x99,0x2B,0x31,0x3D,0xCC,0xD7,0x2C,0x7D,0x53,0x47,0xD3,0xFE},
+{0x23,0x92,0x81,0x45,0x55,0x67,0x95,0xB8,0x58,0xE3,0x4D,0x4C,0x1E,0x40,0xC8,0xC6,
+ 0xB4,0x8E,0x65,0x31,0x04,0xCF,0xFF,0xA9,0x38,0x4F,0xE8,0xA2,0xD7,0xD4,0x22,0xC0},
+{0x1C,0xFE,0xDD,0xA4,0xD1,0x93,0xF1,0x86,0x8C,0x63,0x53,0x8F,0x0F,0x5B,0x28,0xB2,
+ 0xC0,0x7E,0x89,0xD7,0x4B,0xE1,0x4F,0x71,0xD2,0xFF,0xF9,0x21,0x31,0xF8,0x05,0xB4},
+{0xDA,0x2F,0x45,0xF6,0x08,0x0A,0xCB,0x98,0xBE,0x52,0x85,0x06,0xC4,0xF5,0x6A,0xB3,
+ 0xFE,0x02,0xC1,0x53,0x26,0xEC,0xD7,0x83,0xC2,0x31,0x9F,0xD9,0x4D,0xFC,0xC3,0x92},
+{0xB1,0x78,0x69,0x8D,0x8F,0xEC,0x09,0xF9,0x2B,0xB6,0x2F,0x70,0x62,0x17,0x41,0xAA,
+ 0xF4,0x14,0xD0,0xFE,0x7C,0xAF,0xC0,0xE8,0xCF,0xB4,0x4C,0x95,0x92,0xC5,0xDC,0x33},
+{0xF8,0xFA,0x55,0x08,0x35,0xF3,0xF4,0x16,0x1C,0x86,0x28,0xE1,0x31,0x2A,0x4E,0x6C,
+ 0x17,0x88,0x6B,0xF5,0x82,0xF1,0x5B,0x4B,0x21,0x40,0x2F,0x03,0x3B,0xB0,0xE0,0xA5},
+{0x8A,0xA5,0xE7,0x0C,0x89,0x25,0x4C,0x1F,0xEF,0x7F,0x32,0xD0,0xDB,0x28,0x38,0xDE,
+ 0x2F,0x42,0xEB,0x85,0xAC,0x69,0x53,0xF0,0x90,0x4D,0xE2,0x0B,0xF3,0x10,0xE6,0xF1},
+{0xA2,0xB4,0x67,0x0A,0xF3,0xEE,0x97,0x0F,0x49,0x99,0x1F,0xCB,0xAE,0x16,0xD3,0x6D,
+ 0xF9,0x1D,0x79,0x98,0x46,0xD0,0x86,0xD4,0x65,0xB8,0xC5,0xBE,0x94,0xE4,0x64,0xE1},
+{0x68,0xF4,0x82,0x0F,0xFF,0x39,0xA7,0xF3,0xF5,0x93,0x89,0xB4,0x57,0x35,0x6B,0xC7,
+ 0x8F,0xD2,0x4D,0x08,0x88,0xA5,0xD1,0x7E,0x05,0x55,0x17,0xE0,0x51,0x53,0x71,0xFA},
+{0x20,0xF9,0x95,0xCB,0xF4,0x97,0xEC,0xB4,0xE2,0x41,0xA5,0x8D,0xE8,0xFA,0x62,0xAB,
+ 0x78,0xAF,0x36,0x2F,0xDC,0xF2,0xFE,0x2C,0x2B,0x92,0x72,0x14,0xF1,0x09,0x4C,0xA7},
+{0x75,0x01,0xB3,0x6D,0x18,0x19,0xAA,0xC7,0xDF,0xC6,0x6C,0xAB,0x74,0xB2,0xDE,0x75,
+ 0x01,0xB3,0x6D,0x18,0x19,0xAA,0xC7,0xDF,0xC6,0x6C,0xAB,0x74,0xB2,0xDE,0x75,0x01},
+{0xDD,0xE1,0xB8,0x98,0x16,0x0F,0xB4,0x08,0xE0,0xA4,0x4F,0x2F,0x3A,0x11,0x5B,0x18,
+ 0xA7,0x6B,0xD1,0x71,0x4E,0x33,0xED,0x28,0x6E,0xBD,0xF4,0x93,0xD2,0x55,0xB0,0x78},
+{0x44,0x33,0xB7,0xD4,0x5F,0x9A,0xA8,0x7E,0xE3,0xEB,0xED,0x2C,0x1D,0x68,0x2E,0xDF,
+ 0xFA,0x80,0x60,0x28,0x1E,0xCB,0xF5,0x26,0xD9,0x3B,0xB1,0x15,0x6E,0xEF,0xEE,0x8F},
+{0x76,0xC0,0x58,0xBE,0x1C,0x49,0xE2,0xE0,0xC1,0x8B,0x9B,0x14,0xCD,0x4D,0xA0,0x74,
+ 0xE1,0x12,0xAE,0x93,0x90,0x62,0x0D,0x15,0x1E,0x68,0xA8,0xF0,0x4E,0x52,0x1B,0xF9},
+{0xB4,0x17,0x78,0xE1,0x92,0xF4,0x8F,0xFA,0x33,0xFE,0xF9,0xA7,0xA5,0xC0,0x2F,0x01,
+ 0xF1,0xB4,0x17,0x78,0xE1,0x92,0xF4,0x8F,0xFA,0x33,0xFE,0xF9,0xA7,0xA5,0xC0,0x2F},
+{0x43,0x8F,0xE3,0x52,0x86,0x99,0x41,0xA4,0x8B,0xB5,0x82,0xCF,0x91,0xED,0x83,0x19,
+ 0xA5,0x5D,0x81,0x32,0xCD,0xBA,0x85,0x64,0x1D,0xF3,0x8D,0xC8,0x3A,0x61,0x9D,0x17},
+{0x83,0xA7,0x87,0x7B,0x9B,0xE6,0xCF,0x3B,0xE4,0xA1,0x35,0x69,0x8B,0x98,0xBF,0xC6,
+ 0x33,0xDB,0x99,0x88,0xC1,0xB6,0xCE,0x0C,0xE3,0x24,0x20,0xFC,0xE0,0x7D,0x29,0xF4},
+{0x3A,0xF1,0x4D,0x85,0x28,0x1F,0xA5,0x4F,0x9B,0x82,0x05,0x33,0x86,0x39,0xE0,0xB2,
+ 0x92,0xF5,0x71,0x56,0x1C,0xB4,0xB0,0x8C,0x5F,0x6B,0xC0,0xD5,0x16,0xD2,0x3B,0xFE},
+{0x7D,0x92,0x2E,0x04,0x3A,0xD6,0xBA,0x0D,0x83,0x0B,0xA4,0xB6,0x43,0x7E,0x42,0xB3,
+ 0xB4,0x5E,0x15,0x1F,0x76,0x36,0x98,0x47,0x44,0x94,0x09,0xB9,0xDD,0x1E,0xBB,0xC0},
+{0x62,0xFE,0x4C,0x06,0xE1,0xCB,0x8D,0x2F,0x14,0xCF,0x33,0x20,0xE2,0x78,0x2B,0xAA,
+ 0xC0,0xC5,0x97,0xFA,0xF2,0x09,0x17,0x7C,0x95,0xA5,0x36,0x72,0x8F,0x70,0xD0,0xB4},
+{0xD1,0x2F,0x16,0x05,0x24,0xD7,0x17,0x8C,0x1F,0x51,0x40,0xF4,0x71,0x3A,0x0F,0x6C,
+ 0xFE,0x39,0x13,0x21,0xF3,0xC0,0x9B,0x93,0x4E,0x11,0xB4,0x85,0x4B,0x35,0x63,0x92},
+{0x67,0x78,0x1E,0xC4,0x31,0xAE,0xE8,0x3A,0xCD,0x91,0x86,0xE2,0xFB,0x5F,0x76,0xDE,
+ 0xF4,0x3D,0xAD,0x89,0x80,0x20,0x08,0x02,0xC3,0x51,0xB6,0xEE,0xF8,0x3E,0xCC,0x33},
+{0x6A,0xFA,0x59,0xA6,0x0D,0x8E,0x06,0x21,0xBB,0x7B,0xCE,0xE8,0xBE,0x89,0xEB,0x6D,
+ 0x17,0x15,0x0A,0x63,0x4A,0x8D,0xD5,0xBF,0x45,0x1C,0xBA,0xB7,0x39,0x3F,0x1E,0xA5},
+{0x6E,0xA5,0x40,0xF5,0x2A,0x16,0xFA,0x11,0x4D,0xED,0x39,0x78,0x5F,0x51,0xB8,0xC7,
+ 0x2F,0x82,0x4E,0x1C,0x55,0xFE,0x57,0xDD,0x1F,0xA4,0x92,0xD1,0xD5,0x93,0x03,0xF1},
+{0xF2,0xB4,0xB1,0x4C,0x78,0x95,0x69,0x92,0x8D,0xC5,0x8F,0xDC,0xEC,0x33,0x09,0xAB,
+ 0xF9,0x06,0x2B,0xA5,0xB6,0xA8,0x2F,0x97,0x70,0xF1,0x62,0x20,0x17,0x2C,0x41,0xE1},
+{0x7B,0xF4,0xC8,0x6A,0x4E,0xD3,0x62,0x5B,0xA0,0x83,0xE0,0x2B,0x76,0xB8,0xBC,0x75,
+ 0x8F,0x3C,0xA2,0x24,0x9D,0xB1,0x39,0xFB,0x23,0x63,0xCB,0x5D,0xCE,0x04,0xC9,0xFA},
+{0xB0,0xF9,0x13,0x5F,0xA4,0xBD,0xC0,0xCE,0xF8,0x16,0x4E,0xF1,0x3B,0xD7,0x85,0x18,
+ 0x78,0x1F,0x63,0x68,0x4F,0xF4,0x2A,0x82,0x03,0x0F,0x33,0xFF,0x0D,0x39,0xDD,0xA7},
+{0xDF,0x01,0xC6,0xB3,0x6C,0x6D,0xAB,0x18,0x74,0x19,0xB2,0xAA,0xDE,0xC7,0x75,0xDF,
+ 0x01,0xC6,0xB3,0x6C,0x6D,0xAB,0x18,0x74,0x19,0xB2,0xAA,0xDE,0xC7,0x75,0xDF,0x01},
+{0x0A,0xE1,0xC4,0x29,0x53,0x7F,0x9F,0x82,0xCA,0xA2,0x94,0xBA,0x6F,0xB0,0x8E,0x74,
+ 0xA7,0x27,0xD8,0xB8,0x5A,0x72,0xF8,0xE6,0x42,0x89,0xF2,0x07,0x86,0xA0,0xA1,0x78},
+{0xF1,0x33,0xB4,0xFE,0x17,0xF9,0x78,0xA7,0xE1,0xA5,0x92,0xC0,0xF4,0x2F,0x8F,0x01,
+ 0xFA,0xF1,0x33,0xB4,0xFE,0x17,0xF9,0x78,0xA7,0xE1,0xA5,0x92,0xC0,0xF4,0x2F,0x8F},
+{0x12,0xC0,0x10,0x81,0x7E,0xC9,0x70,0x89,0xFD,0xF6,0xD7,0xB1,0x7A,0x4B,0xAC,0x19,
+ 0xE1,0x76,0x4A,0x4F,0x2E,0xC5,0x71,0x6A,0xCA,0xD2,0xD0,0x91,0xFF,0xB7,0xB9,0xF9},
+{0xB7,0x17,0x8E,0x02,0x88,0x1D,0xAF,0x6B,0x12,0x5D,0xF5,0xC5,0x3D,0x82,0x3C,0xC6,
+ 0xF1,0x52,0x07,0x5B,0xEA,0xE2,0x4B,0x3F,0x0A,0x21,0x69,0x9A,0x40,0x5A,0xAE,0x2F},
+{0x2A,0x8F,0x32,0x03,0xD2,0x1C,0x33,0x4D,0x5B,0x0D,0x08,0xF9,0xDD,0x88,0x5F,0xB2,
+ 0xA5,0xBD,0x31,0xD1,0xCE,0x2F,0x7E,0x16,0x56,0x05,0xF1,0x24,0x55,0xD7,0xED,0x17},
+{0x84,0xA7,0x65,0xC1,0x6B,0x79,0x36,0xD1,0xAE,0x81,0x71,0x97,0xAD,0x4E,0xA2,0xB3,
+ 0x33,0x07,0x5C,0xED,0x54,0x4C,0x28,0xAC,0x0B,0x6E,0xAF,0xC4,0xBD,0x8B,0x5A,0xF4},
+{0xCF,0xF1,0xF2,0x62,0xB4,0x20,0xB1,0x17,0x4C,0x2C,0x78,0x41,0x95,0xE1,0x69,0xAA,
+ 0x92,0x36,0x8D,0xF4,0xC5,0x9F,0x8F,0x14,0xDC,0xFA,0xEC,0xD0,0x33,0xBA,0x09,0xFE},
+{0xF3,0x92,0x31,0x53,0xF5,0x98,0x2F,0x71,0x93,0x32,0x56,0xFA,0x89,0x1C,0x24,0x6C,
+ 0xB4,0x5B,0xED,0xB0,0x57,0xF9,0x8C,0x13,0x35,0x5F,0xE1,0xA4,0x6B,0xBD,0x40,0xC0},
+{0x5C,0xFE,0x2D,0xB9,0x39,0x83,0x7C,0x13,0x73,0xC3,0x21,0xAF,0x87,0xF3,0x79,0xDE,
+ 0xC0,0xE7,0x43,0x9B,0x50,0xE8,0x93,0xC9,0x3C,0x4E,0xCF,0x37,0x11,0xF7,0xF6,0xB4},
+{0x30,0x2F,0x04,0x26,0x82,0x46,0xDC,0x4E,0x90,0xCD,0x1C,0xF2,0x80,0x55,0x9D,0x6D,
+ 0xFE,0xEA,0x54,0x57,0x8E,0x2C,0xDD,0x84,0x73,0x1F,0x2B,0x22,0xA4,0xC4,0x9A,0x92},
+{0x8C,0x78,0xE0,0x35,0x1F,0x6E,0xE1,0x63,0x51,0x6B,0x68,0x92,0x40,0x4F,0x53,0xC7,
+ 0xF4,0x98,0xD5,0x2A,0x71,0x8F,0x82,0x32,0x3A,0x03,0xFA,0xD2,0x0F,0x1C,0x94,0x33},
+{0x70,0xFA,0xCF,0xEC,0xF1,0xD0,0xF2,0x33,0x62,0xBA,0xB4,0x09,0x20,0xFE,0xB1,0xAB,
+ 0x17,0xE2,0x4C,0xF9,0x2C,0x7C,0x78,0x06,0x41,0xA7,0x95,0x2B,0xE1,0xAF,0x69,0xA5},
+{0x66,0xA5,0xBB,0x9A,0xBD,0x12,0xB6,0x31,0xE9,0x1A,0xD1,0xA8,0x10,0xCE,0xB5,0x75,
+ 0x2F,0xC8,0x3D,0x7E,0x0C,0x97,0x16,0x46,0xBE,0x56,0x70,0xE3,0x05,0xCC,0xCD,0xF1},
+{0x4D,0xB4,0xFF,0xD7,0x5B,0x86,0xFE,0xED,0x0D,0x85,0xB0,0x17,0x08,0x57,0x39,0x18,
+ 0xF9,0x4B,0x28,0x8C,0xDD,0x78,0x13,0xE0,0x88,0x35,0xA7,0x1F,0x5F,0x6E,0x21,0xE1},
+{0xEE,0xF4,0xAE,0x7F,0x98,0x30,0xC5,0xD5,0x96,0x58,0x2A,0x9F,0x04,0x71,0xF0,0xDF,
+ 0x8F,0x47,0xBF,0x82,0x6A,0x14,0x32,0x3E,0xAD,0x3A,0xDC,0xCA,0x03,0x45,0x44,0xFA},
+{0xA1,0xF9,0xA9,0x83,0x4B,0xD4,0x2C,0x28,0x15,0x64,0x8C,0x7C,0x02,0xDD,0xFB,0x74,
+ 0x78,0x3F,0xAC,0x13,0x84,0x06,0xE0,0x8A,0x9C,0x88,0x41,0x73,0x35,0x0B,0x0A,0xA7},
+{0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+ 0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01},
+{0xC6,0x49,0x28,0x48,0xA8,0x32,0xF7,0xB9,0x1F,0xB6,0x04,0x89,0x6F,0xFB,0xA5,0xAE,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x19,0x29,0x2A,0x90,0x09,0x28,0xC1,0xE7,0x16,0xF2,0x5E,0x35,0x4A,0x96,0xFA,0x9D,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x01,0x33,0x17,0xA7,0x92,0x2F,0xFA,0xB4,0xF9,0xE1,0xC0,0x8F,0xF1,0xFE,0x78,0xA5,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x74,0x87,0xF5,0xC9,0xF2,0x85,0x9C,0x0E,0x98,0xDC,0x91,0x08,0x23,0x12,0x2F,0xE3,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xDF,0xCD,0x5B,0x15,0xAF,0x53,0x0C,0xD6,0x86,0x7C,0x48,0xD1,0xBF,0x61,0xFE,0xFB,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x18,0x6E,0x40,0x2A,0xFA,0x4D,0x39,0x5F,0xB8,0x2F,0x4E,0x55,0x57,0x1F,0x92,0xD5,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x75,0xCA,0x3B,0x54,0x41,0xF3,0xAE,0x46,0x94,0xB1,0x3F,0x51,0xE7,0xBF,0xF1,0x6F,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xAB,0x06,0xA5,0xA8,0x97,0xF1,0x20,0x2C,0xE1,0x36,0x9F,0xFA,0xBA,0xE2,0xA7,0xCB,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xC7,0x93,0x0F,0xD7,0xF9,0x6E,0xB8,0xD5,0x56,0x33,0x85,0x13,0x51,0xD1,0x8F,0x89,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x6D,0xA9,0x6E,0x29,0xC5,0x3A,0xA3,0x60,0xDD,0xAF,0xE9,0xF8,0xE3,0xF6,0x17,0x9C,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xDE,0x96,0x56,0x52,0xB1,0xDD,0x7D,0x7B,0x2A,0x70,0x80,0x85,0x3F,0x48,0xC0,0x04,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x6C,0xB0,0x13,0xA4,0xC0,0xF8,0x4E,0x3B,0x85,0x78,0x63,0x4F,0x2A,0x03,0x33,0x0D,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xAA,0xA8,0x8F,0xCF,0xBA,0x17,0x06,0x69,0xC0,0x9F,0x70,0x33,0xB1,0x7C,0xE1,0xB6,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xB3,0x6D,0x18,0x19,0xAA,0xC7,0xDF,0xC6,0x6C,0xAB,0x74,0xB2,0xDE,0x75,0x01,0xB3,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xB2,0x40,0x9B,0x32,0xF1,0xFF,0x57,0x88,0x51,0xC0,0x2A,0x56,0x94,0x86,0xF9,0x1F,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xC6,0x91,0x0D,0x64,0x2B,0xBD,0x10,0x0C,0x05,0x62,0xEA,0x8C,0x65,0x4A,0xF4,0x47,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x19,0xD8,0x53,0xC8,0xDC,0x11,0x5C,0xFC,0x88,0x69,0x7B,0xD5,0x46,0xD6,0xB4,0xB9,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x01,0xF1,0xB4,0x17,0x78,0xE1,0x92,0xF4,0x8F,0xFA,0x33,0xFE,0xF9,0xA7,0xA5,0xC0,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x74,0xC2,0xBD,0x2E,0xE8,0x03,0xFD,0x5C,0x57,0x06,0x7D,0xB8,0xAE,0x0C,0xFA,0xF7,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xDF,0x45,0x94,0x5C,0xE2,0x13,0x27,0x79,0xF5,0xE8,0x42,0x11,0x49,0x77,0x78,0xC2,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x18,0x88,0x63,0xB8,0xF4,0x7E,0x03,0x11,0xFF,0x17,0xDD,0x6E,0xF3,0x53,0x2F,0x32,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x75,0xE6,0x05,0xF7,0x20,0x57,0xAC,0xC2,0x68,0x8D,0x58,0x32,0xA2,0x91,0xFE,0x99,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xAB,0x2C,0xA7,0x69,0xB6,0xF4,0xE8,0xDC,0xF1,0xBA,0xB1,0xF9,0x41,0xAF,0x92,0xA8,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xC7,0x2A,0x32,0xD2,0x33,0x5B,0x08,0xDD,0x5F,0xA5,0x31,0xCE,0x7E,0x56,0xF1,0x55,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x6D,0xB9,0x8C,0x23,0x69,0xB8,0x2E,0xC8,0x32,0xCF,0x52,0xD7,0x54,0x15,0xA7,0x48,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xDE,0x10,0xF8,0x46,0xCF,0x24,0x49,0x5E,0x4B,0x41,0x22,0x68,0xE5,0x30,0x8F,0xCA,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x6C,0x86,0x08,0x8C,0xA7,0x63,0xBD,0x53,0x9B,0x8F,0x56,0x0F,0x3B,0x5B,0x17,0x28,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xAA,0x36,0xF4,0x9F,0x14,0xFA,0xD0,0xBA,0xFE,0xE2,0x7C,0xA7,0xAF,0xCB,0xC0,0x72,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xB3,0x9E,0x86,0xB9,0x2C,0x88,0xC2,0xD8,0x40,0xA8,0x96,0x93,0xCA,0xCD,0x33,0x49,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xB2,0xF3,0x31,0xF5,0x2F,0x93,0x56,0x89,0x24,0xB4,0xED,0x57,0x8C,0x35,0xE1,0x6B,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xC6,0xB3,0x6C,0x6D,0xAB,0x18,0x74,0x19,0xB2,0xAA,0xDE,0xC7,0x75,0xDF,0x01,0xC6,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x19,0x22,0x6B,0xDA,0x8D,0x98,0x04,0x6A,0x03,0xEC,0xA3,0x4D,0xDB,0x54,0xF9,0x3F,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x01,0xFA,0xF1,0x33,0xB4,0xFE,0x17,0xF9,0x78,0xA7,0xE1,0xA5,0x92,0xC0,0xF4,0x2F,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x74,0x0B,0x21,0x66,0xCB,0x31,0xE7,0xB5,0xF8,0x97,0x3C,0x05,0x61,0xEB,0xB4,0x1B,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xDF,0xC9,0x03,0xCC,0xD0,0x3B,0x9D,0x1B,0xB0,0x4C,0x64,0xE0,0xC3,0x22,0xA5,0x4A,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x18,0x8C,0xE0,0x1F,0xE1,0x51,0x68,0x40,0x53,0xF4,0xD5,0x71,0x82,0x3A,0xFA,0x0F,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x75,0x04,0x93,0x3E,0x70,0xD2,0x61,0x52,0x55,0x09,0xE4,0xB0,0xFC,0xD4,0x78,0x73,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xAB,0xE2,0xF9,0x7C,0x06,0xA7,0x2B,0xAF,0xA5,0xCB,0xB6,0xC0,0xA8,0x72,0x2F,0xE8,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xC7,0xCE,0xD5,0xF8,0x8F,0x16,0x3A,0x4E,0xD2,0xF1,0x94,0x3B,0x4D,0xD7,0xFE,0x85,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x6D,0xE4,0x85,0x77,0x4C,0x4B,0x02,0x84,0x35,0x95,0xC2,0x63,0x76,0x0E,0x92,0x8B,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xDE,0x5D,0xD1,0xEE,0x72,0xD5,0xC8,0xF0,0x93,0x14,0xBE,0x03,0xD9,0xA2,0xF1,0x59,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x6C,0x4D,0xFF,0x5B,0xFE,0x0D,0xB0,0x08,0x39,0xF9,0x28,0xDD,0x13,0x88,0xA7,0x5F,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xAA,0xCB,0x92,0xB6,0x36,0xC0,0x8D,0xA8,0xF4,0x72,0xC5,0x2F,0x9F,0xE8,0x8F,0x97,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xB3,0xFD,0x24,0xEB,0x62,0x55,0x34,0x25,0xD7,0x20,0x1B,0xED,0xEA,0x5E,0x17,0x7A,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xB2,0x63,0xA4,0x51,0xA5,0x6B,0xF3,0x68,0xBD,0x92,0xB8,0x40,0x31,0x4F,0xC0,0x53,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0xC6,0x90,0xD2,0xA2,0xEC,0x0F,0xD6,0xD3,0x1C,0xD0,0x59,0x94,0xA3,0x52,0x33,0x80,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x19,0x23,0x1F,0xC3,0x95,0x5F,0x1D,0x1E,0x6E,0x2B,0x65,0x21,0xC2,0x38,0xE1,0x27,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+};
+
+/* Powers of alpha, CHIEN_POW[j][t] = alpha ** (j * t) */
+static const uint8_t CHIEN_POW[MAX_ROOTS + 1][32] = {
+{0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+ 0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01},
+{0x01,0x02,0x04,0x08,0x10,0x20,0x40,0x80,0x87,0x89,0x95,0xAD,0xDD,0x3D,0x7A,0xF4,
+ 0x6F,0xDE,0x3B,0x76,0xEC,0x5F,0xBE,0xFB,0x71,0xE2,0x43,0x86,0x8B,0x91,0xA5,0xCD},
+{0x01,0x04,0x10,0x40,0x87,0x95,0xDD,0x7A,0x6F,0x3B,0xEC,0xBE,0x71,0x43,0x8B,0xA5,
+ 0x1D,0x74,0x57,0xDB,0x62,0x0F,0x3C,0xF0,0xCE,0x36,0xD8,0x6E,0x3F,0xFC,0xFE,0xF6},
+{0x01,0x08,0x40,0x89,0xDD,0xF4,0x3B,0x5F,0x71,0x86,0xA5,0x3A,0x57,0x31,0x0F,0x78,
+ 0xCE,0x6C,0x6E,0x7E,0xFE,0x6B,0x56,0x39,0x4F,0xF1,0x13,0x98,0x55,0x21,0x8F,0xED},
+{0x01,0x10,0x87,0xDD,0x6F,0xEC,0x71,0x8B,0x1D,0x57,0x62,0x3C,0xCE,0xD8,0x3F,0xFE,
+ 0xD6,0xDF,0x4F,0x65,0x4C,0x55,0x42,0xB5,0xF3,0x06,0x60,0x1C,0x47,0xE5,0xE1,0xA1},
+{0x01,0x20,0x95,0xF4,0xEC,0xE2,0xA5,0xE8,0x62,0x78,0x36,0xDC,0xFE,0x2B,0x72,0xF1,
+ 0x4C,0xAA,0x8F,0xBA,0x06,0xC0,0x70,0xB1,0xE1,0xC5,0xD0,0xF9,0xCB,0x97,0xB4,0x41},
+{0x01,0x40,0xDD,0x3B,0x71,0xA5,0x57,0x0F,0xCE,0x6E,0xFE,0x56,0x4F,0x13,0x55,0x8F,
+ 0xF3,0x18,0x1C,0x9B,0xE1,0x0D,0x4E,0x53,0x88,0xB4,0x82,0xBD,0x4B,0x94,0x2F,0x63},
+{0x01,0x80,0x7A,0x5F,0x8B,0xE8,0x0F,0x1B,0x3F,0x6B,0x72,0xCA,0x55,0x99,0xC2,0xC0,
+ 0x47,0xB3,0x0D,0x9C,0xCB,0xD5,0xE3,0x9D,0x4B,0xAF,0xBC,0x16,0xA3,0xA0,0xA7,0x29},
+{0x01,0x87,0x6F,0x71,0x1D,0x62,0xCE,0x3F,0xD6,0x4F,0x4C,0x42,0xF3,0x60,0x47,0xE1,
+ 0x34,0x75,0x88,0x59,0x8D,0x4B,0xD9,0x79,0xB0,0x14,0x48,0xD7,0xC8,0x23,0x33,0xEE},
+{0x01,0x89,0x3B,0x86,0x57,0x78,0x6E,0x6B,0x4F,0x98,0x8F,0x03,0x1C,0x4D,0x0D,0xF9,
+ 0x88,0xB2,0xBD,0xD1,0x2F,0x16,0x05,0x24,0xD7,0x17,0x8C,0x1F,0x51,0x40,0xF4,0x71},
+{0x01,0x95,0xEC,0xA5,0x62,0x36,0xFE,0x72,0x4C,0x8F,0x06,0x70,0xE1,0xD0,0xCB,0xB4,
+ 0x8D,0xAB,0x2F,0x2C,0x14,0xA7,0xCF,0x69,0x33,0xB6,0x20,0xF4,0xE2,0xE8,0x78,0xDC},
+{0x01,0xAD,0xBE,0x3A,0x3C,0xDC,0x56,0xCA,0x42,0x03,0x70,0x45,0x4E,0x44,0xE3,0xFA,
+ 0xD9,0xC6,0x05,0x90,0xCF,0xD2,0xCC,0xA2,0x89,0xEC,0xCD,0x0F,0x37,0xD6,0xF1,0xD3},
+{0x01,0xDD,0x71,0x57,0xCE,0xFE,0x4F,0x55,0xF3,0x1C,0xE1,0x4E,0x88,0x82,0x4B,0x2F,
+ 0xB0,0xC7,0xD7,0xB8,0x33,0x51,0x89,0x5F,0x3A,0x78,0x7E,0x39,0x98,0xED,0xC0,0x4D},
+{0x01,0x3D,0x43,0x31,0xD8,0x2B,0x13,0x99,0x60,0x4D,0xD0,0x44,0x82,0x96,0xBC,0x92,
+ 0x48,0x19,0x8C,0x77,0x20,0x3B,0xCD,0x3C,0x7E,0x72,0xE9,0xF3,0x38,0x8A,0xF9,0x2D},
+{0x01,0x7A,0x8B,0x0F,0x3F,0x72,0x55,0xC2,0x47,0x0D,0xCB,0xE3,0x4B,0xBC,0xA3,0xA7,
+ 0xC8,0x6D,0x51,0xAD,0xE2,0x31,0x37,0xAC,0x98,0xBA,0x38,0x93,0xEA,0xEF,0xFA,0xD4},
+{0x01,0xF4,0xA5,0x78,0xFE,0xF1,0x8F,0xC0,0xE1,0xF9,0xB4,0xFA,0x2F,0x92,0xA7,0x17,
+ 0x33,0x01,0xF4,0xA5,0x78,0xFE,0xF1,0x8F,0xC0,0xE1,0xF9,0xB4,0xFA,0x2F,0x92,0xA7},
+{0x01,0x6F,0x1D,0xCE,0xD6,0x4C,0xF3,0x47,0x34,0x88,0x8D,0xD9,0xB0,0x48,0xC8,0x33,
+ 0x02,0xDE,0x3A,0x1B,0x2B,0x98,0x61,0x8E,0x68,0x97,0x9D,0x35,0xE7,0x90,0x17,0x66},
+{0x01,0xDE,0x74,0x6C,0xDF,0xAA,0x18,0xB3,0x75,0xB2,0xAB,0xC6,0xC7,0x19,0x6D,0x01,
+ 0xDE,0x74,0x6C,0xDF,0xAA,0x18,0xB3,0x75,0xB2,0xAB,0xC6,0xC7,0x19,0x6D,0x01,0xDE},
+{0x01,0x3B,0x57,0x6E,0x4F,0x8F,0x1C,0x0D,0x88,0xBD,0x2F,0x05,0xD7,0x8C,0x51,0xF4,
+ 0x3A,0x6C,0x39,0x21,0xC0,0x93,0x11,0x85,0x35,0x92,0x2A,0xD2,0x5B,0xDD,0xA5,0xCE},
+{0x01,0x76,0xDB,0x7E,0x65,0xBA,0x9B,0x9C,0x59,0xD1,0x2C,0x90,0xB8,0x77,0xAD,0xA5,
+ 0x1B,0xDF,0x21,0x07,0xC5,0x88,0xFD,0xBC,0x28,0xCF,0xDA,0x08,0xBE,0xC4,0xFE,0x26},
+{0x01,0xEC,0x62,0xFE,0x4C,0x06,0xE1,0xCB,0x8D,0x2F,0x14,0xCF,0x33,0x20,0xE2,0x78,
+ 0x2B,0xAA,0xC0,0xC5,0x97,0xFA,0xF2,0x09,0x17,0x7C,0x95,0xA5,0x36,0x72,0x8F,0x70},
+{0x01,0x5F,0x0F,0x6B,0x55,0xC0,0x0D,0xD5,0x4B,0x16,0xA7,0xD2,0x51,0x3B,0x31,0xFE,
+ 0x98,0x18,0x93,0x88,0xFA,0x63,0x24,0xB8,0x5B,0xF4,0x57,0x7E,0x13,0x03,0xE1,0x11},
+{0x01,0xBE,0x3C,0x56,0x42,0x70,0x4E,0xE3,0xD9,0x05,0xCF,0xCC,0x89,0xCD,0x37,0xF1,
+ 0x61,0xB3,0x11,0xFD,0xF2,0x24,0xF7,0xEB,0x3B,0x62,0xF6,0x55,0x07,0x34,0xB4,0x25},
+{0x01,0xFB,0xF0,0x39,0xB5,0xB1,0x53,0x9D,0x79,0x24,0x69,0xA2,0x5F,0x3C,0xAC,0x8F,
+ 0x8E,0x75,0x85,0xBC,0x09,0xB8,0xEB,0x76,0x0F,0x2B,0x42,0xE0,0xBF,0x83,0x2F,0xA0},
+{0x01,0x71,0xCE,0x4F,0xF3,0xE1,0x88,0x4B,0xB0,0xD7,0x33,0x89,0x3A,0x7E,0x98,0xC0,
+ 0x68,0xB2,0x35,0x28,0x17,0x5B,0x3B,0x0F,0x56,0x8F,0x9B,0x53,0xBD,0x63,0xA7,0x8C},
+{0x01,0xE2,0x36,0xF1,0x06,0xC5,0xB4,0xAF,0x14,0x17,0xB6,0xEC,0x78,0x72,0xBA,0xE1,
+ 0x97,0xAB,0x92,0xCF,0x7C,0xF4,0x62,0x2B,0x8F,0xB1,0xCB,0xFA,0x2C,0xA8,0x33,0x95},
+{0x01,0x43,0xD8,0x13,0x60,0xD0,0x82,0xBC,0x48,0x8C,0x20,0xCD,0x7E,0xE9,0x38,0xF9,
+ 0x9D,0xC6,0x2A,0xDA,0x95,0x57,0xF6,0x42,0x9B,0xCB,0x73,0xB0,0x52,0x3E,0xF4,0xC4},
+{0x01,0x86,0x6E,0x98,0x1C,0xF9,0xBD,0x16,0xD7,0x1F,0xF4,0x0F,0x39,0xF3,0x93,0xB4,
+ 0x35,0xC7,0xD2,0x08,0xA5,0x7E,0x55,0xE0,0x53,0xFA,0xB0,0xA4,0xF8,0x3B,0x78,0x4F},
+{0x01,0x8B,0x3F,0x55,0x47,0xCB,0x4B,0xA3,0xC8,0x51,0xE2,0x37,0x98,0x38,0xEA,0xFA,
+ 0xE7,0x19,0x5B,0xBE,0x36,0x13,0x07,0xBF,0xBD,0x2C,0x52,0xF8,0x76,0x67,0xF1,0x30},
+{0x01,0x91,0xFC,0x21,0xE5,0x97,0x94,0xA0,0x23,0x40,0xE8,0xD6,0xED,0x8A,0xEF,0x2F,
+ 0x90,0x6D,0xDD,0xC4,0x72,0x03,0x34,0x83,0x63,0xA8,0x3E,0x3B,0x67,0x65,0xC0,0xBF},
+{0x01,0xA5,0xFE,0x8F,0xE1,0xB4,0x2F,0xA7,0x33,0xF4,0x78,0xF1,0xC0,0xF9,0xFA,0x92,
+ 0x17,0x01,0xA5,0xFE,0x8F,0xE1,0xB4,0x2F,0xA7,0x33,0xF4,0x78,0xF1,0xC0,0xF9,0xFA},
+{0x01,0xCD,0xF6,0xED,0xA1,0x41,0x63,0x29,0xEE,0x71,0xDC,0xD3,0x4D,0x2D,0xD4,0xA7,
+ 0x66,0xDE,0xCE,0x26,0x70,0x11,0x25,0xA0,0x8C,0x95,0xC4,0x4F,0x30,0xBF,0xFA,0xA3},
+{0x01,0x1D,0xD6,0xF3,0x34,0x8D,0xB0,0xC8,0x02,0x3A,0x2B,0x61,0x68,0x9D,0xE7,0x17,
+ 0x04,0x74,0x56,0xC2,0xD0,0xBD,0x49,0x2E,0x08,0xE8,0xAC,0x03,0x27,0xFD,0x92,0x5C},
+{0x01,0x3A,0x56,0x03,0x4E,0xFA,0x05,0xD2,0x89,0x0F,0xF1,0x1C,0x11,0x94,0x24,0x33,
+ 0x3B,0x6C,0x55,0x4D,0xB4,0xFF,0xD7,0x5B,0x86,0xFE,0xED,0x0D,0x85,0xB0,0x17,0x08},
+{0x01,0x74,0xDF,0x18,0x75,0xAB,0xC7,0x6D,0xDE,0x6C,0xAA,0xB3,0xB2,0xC6,0x19,0x01,
+ 0x74,0xDF,0x18,0x75,0xAB,0xC7,0x6D,0xDE,0x6C,0xAA,0xB3,0xB2,0xC6,0x19,0x01,0x74},
+{0x01,0xE8,0x72,0xC0,0xCB,0xAF,0xA7,0x7C,0xE2,0xFE,0xBA,0xD0,0xFA,0x14,0x9F,0xF4,
+ 0x36,0xAA,0xE1,0x41,0x2C,0x17,0x20,0x62,0xF1,0x70,0x97,0x2F,0xA8,0xB6,0xA5,0x2B},
+{0x01,0x57,0x4F,0x1C,0x88,0x2F,0xD7,0x51,0x3A,0x39,0xC0,0x11,0x35,0x2A,0x5B,0xA5,
+ 0x56,0x18,0x53,0x94,0xA7,0xF8,0x86,0x6B,0x03,0xF9,0xD1,0x24,0x1F,0x71,0xFE,0xF3},
+{0x01,0xAE,0xBB,0xE0,0x2D,0xF2,0x32,0x10,0xC4,0x13,0xB1,0x59,0x16,0x2E,0x87,0x78,
+ 0xB7,0xB3,0x82,0xE7,0x69,0xDD,0x1B,0xD3,0x93,0x8D,0xC1,0x8C,0x6F,0x37,0x8F,0x1A},
+{0x01,0xDB,0x65,0x9B,0x59,0x2C,0xB8,0xAD,0x1B,0x21,0xC5,0xFD,0x28,0xDA,0xBE,0xFE,
+ 0xC2,0x75,0x94,0x15,0xB6,0x3A,0xE4,0x38,0xD5,0xF2,0x64,0x40,0x3C,0xB7,0xE1,0x81},
+{0x01,0x31,0x13,0x4D,0x82,0x92,0x8C,0x3B,0x7E,0xF3,0xF9,0x94,0x2A,0x51,0x57,0xF1,
+ 0x9B,0xB2,0xB0,0xD2,0xF4,0x6E,0xED,0x4E,0xD1,0xA7,0x5B,0x3A,0x4F,0xE0,0xB4,0x16},
+{0x01,0x62,0x4C,0xE1,0x8D,0x14,0x33,0xE2,0x2B,0xC0,0x97,0xF2,0x17,0x95,0x36,0x8F,
+ 0xD0,0xAB,0xA7,0xB6,0xE8,0xF1,0xB1,0x41,0x92,0x9F,0xEC,0xFE,0x06,0xCB,0x2F,0xCF},
+{0x01,0xC4,0xB7,0x93,0x7D,0x09,0xF8,0x1D,0x9E,0x9B,0x41,0xA3,0xF5,0xFB,0xD6,0xC0,
+ 0xA9,0xC6,0xB8,0x7A,0xDC,0xF3,0xEA,0x6A,0xA4,0x20,0xF0,0x21,0x34,0x96,0xA7,0xEB},
+{0x01,0x0F,0x55,0x0D,0x4B,0xA7,0x51,0x31,0x98,0x93,0xFA,0x24,0x5B,0x57,0x13,0xE1,
+ 0xBD,0xC7,0xF8,0x3A,0xF1,0x4D,0x85,0x28,0x1F,0xA5,0x4F,0x9B,0x82,0x05,0x33,0x86},
+{0x01,0x1E,0xD3,0x68,0x25,0xA8,0x08,0xF0,0x84,0x4E,0xAF,0x52,0x40,0x1B,0xB5,0xF9,
+ 0x6A,0x19,0x89,0xD8,0xBA,0x53,0x5E,0xC8,0xDD,0xDC,0xC2,0x11,0x79,0x5C,0xF4,0xFC},
+{0x01,0x3C,0x42,0x4E,0xD9,0xCF,0x89,0x37,0x61,0x11,0xF2,0xF7,0x3B,0xF6,0x07,0xB4,
+ 0x49,0x6D,0x86,0xE4,0xB1,0x85,0xA0,0x77,0x57,0x4C,0xA1,0x4B,0x15,0x02,0x78,0x84},
+{0x01,0x78,0x8F,0xF9,0x2F,0x17,0xF4,0xFE,0xC0,0xB4,0x92,0x33,0xA5,0xF1,0xE1,0xFA,
+ 0xA7,0x01,0x78,0x8F,0xF9,0x2F,0x17,0xF4,0xFE,0xC0,0xB4,0x92,0x33,0xA5,0xF1,0xE1},
+{0x01,0xF0,0xB5,0x53,0x79,0x69,0x5F,0xAC,0x8E,0x85,0x09,0xEB,0x0F,0x42,0xBF,0x2F,
+ 0x2E,0xDE,0x6B,0x38,0x41,0x28,0x77,0xDB,0x55,0xD0,0xD9,0x32,0x3D,0x7F,0xC0,0xEF},
+{0x01,0x67,0x5D,0x11,0x0B,0x9F,0x86,0xBB,0x45,0x4B,0xA8,0x80,0x6E,0x0C,0x2D,0x92,
+ 0xCC,0x74,0x98,0x34,0xAF,0x32,0x7A,0x7B,0x1C,0x41,0x50,0x5B,0xC4,0x42,0xF9,0xBC},
+{0x01,0xCE,0xF3,0x88,0xB0,0x33,0x3A,0x98,0x68,0x35,0x17,0x3B,0x56,0x9B,0xBD,0xA7,
+ 0x08,0x6C,0x03,0xD5,0x92,0x1F,0x57,0x55,0x4E,0x2F,0xB8,0x5F,0x39,0x4D,0xFA,0x2A},
+};
+
+/* The supported codes */
+typedef struct {
+	int nroots;
+	int fcr;
+	const uint8_t *genpoly_lo;
+	const uint8_t *genpoly_hi;
+	const uint8_t (*syn_pow)[32];
+} rs8_code_t;
+
+static const rs8_code_t RS8_CODES[] = {
+	{  8, 124, &GENPOLY8_LO[0][0],  &GENPOLY8_HI[0][0],  SYN_POW8  },
+	{ 16, 120, &GENPOLY16_LO[0][0], &GENPOLY16_HI[0][0], SYN_POW16 },
+	{ 32, 112, &GENPOLY32_LO[0][0], &GENPOLY32_HI[0][0], SYN_POW32 },
+	{ 48, 104, &GENPOLY48_LO[0][0], &GENPOLY48_HI[0][0], SYN_POW48 },
+};
+
+static const rs8_code_t *rs8_code(int nroots)
+{
+	int i;
+	
+	for(i = 0; i < sizeof(RS8_CODES) / sizeof(RS8_CODES[0]); i++)
+	{
+		if(RS8_CODES[i].nroots == nroots) return(&RS8_CODES[i]);
+	}
+	
+	return(NULL);
+}
+
+
+/* Portable C version, for any of the codes */
+static void encode_rs_8_c(const rs8_code_t *code, uint8_t *data, uint8_t *parity, int len)
 {
-	int i, j;
+	uint8_t reg[NN + MAX_ROOTS];
+	uint8_t feedback, *r;
+	const uint8_t *glo, *ghi;
+	int i, j, nroots = code->nroots;
+	
+	/* The parity register slides along reg[] rather than being shifted */
+	memset(reg, 0, (len + nroots) * sizeof(uint8_t));
+	
+	for(i = 0; i < len; i++)
+	{
+		feedback = data[i] ^ reg[i];
+		if(feedback == 0) continue;
+		
+		r = &reg[i + 1];
+		glo = &code->genpoly_lo[(feedback & 0x0F) * nroots];
+		ghi = &code->genpoly_hi[(feedback >> 4) * nroots];
+		for(j = 0; j < nroots; j++)
+			r[j] ^= glo[j] ^ ghi[j];
+	}
+	
+	memcpy(parity, &reg[len], nroots * sizeof(uint8_t));
+}
+
+#ifdef RS8_X86
+
+/* SSSE3 version for 32 roots, the parity register is held in two vectors */
+__attribute__((target("ssse3")))
+static void encode_rs_8_ssse3(uint8_t *data, uint8_t *parity, int len)
+{
+	__m128i lo = _mm_setzero_si128(), hi = _mm_setzero_si128();
 	uint8_t feedback;
+	int i;
 	
-	memset(parity, 0, NROOTS * sizeof(uint8_t));
+	for(i = 0; i < len; i++)
+	{
+		feedback = data[i] ^ _mm_cvtsi128_si32(lo);
+		
+		/* Shift */
+		lo = _mm_alignr_epi8(hi, lo, 1);
+		hi = _mm_srli_si128(hi, 1);
+		
+		if(feedback == 0) continue;
+		
+		lo = _mm_xor_si128(lo, _mm_xor_si128(
+			_mm_loadu_si128((const __m128i *) &GENPOLY32_LO[feedback & 0x0F][0]),
+			_mm_loadu_si128((const __m128i *) &GENPOLY32_HI[feedback >> 4][0])));
+		hi = _mm_xor_si128(hi, _mm_xor_si128(
+			_mm_loadu_si128((const __m128i *) &GENPOLY32_LO[feedback & 0x0F][16]),
+			_mm_loadu_si128((const __m128i *) &GENPOLY32_HI[feedback >> 4][16])));
+	}
 	
-	for(i = 0; i < NN - NROOTS - pad; i++)
+	_mm_storeu_si128((__m128i *) &parity[0], lo);
+	_mm_storeu_si128((__m128i *) &parity[16], hi);
+}
+
+/* AVX2 version for 32 roots, the parity register is held in one vector */
+__attribute__((target("avx2")))
+static void encode_rs_8_avx2(uint8_t *data, uint8_t *parity, int len)
+{
+	__m256i reg = _mm256_setzero_si256();
+	uint8_t feedback;
+	int i;
+	
+	for(i = 0; i < len; i++)
 	{
-		feedback = INDEX_OF[data[i] ^ parity[0]];
-		if(feedback != A0) /* feedback term is non-zero */
-		{
-			for(j = 1; j < NROOTS; j++)
-				parity[j] ^= ALPHA_TO[mod255(feedback + GENPOLY[NROOTS - j])];
-		}
+		feedback = data[i] ^ _mm_cvtsi128_si32(_mm256_castsi256_si128(reg));
+		
+		/* Shift, moving the upper lane down to fill the gap */
+		reg = _mm256_alignr_epi8(_mm256_permute2x128_si256(reg, reg, 0x81), reg, 1);
+		
+		if(feedback == 0) continue;
+		
+		reg = _mm256_xor_si256(reg, _mm256_xor_si256(
+			_mm256_loadu_si256((const __m256i *) GENPOLY32_LO[feedback & 0x0F]),
+			_mm256_loadu_si256((const __m256i *) GENPOLY32_HI[feedback >> 4])));
+	}
+	
+	_mm256_storeu_si256((__m256i *) parity, reg);
+}
+
+#endif
+
+#ifdef RS8_NEON
+
+/* NEON version for 32 roots, the parity register is held in two vectors */
+static void encode_rs_8_neon(uint8_t *data, uint8_t *parity, int len)
+{
+	uint8x16_t lo = vdupq_n_u8(0), hi = vdupq_n_u8(0);
+	uint8_t feedback;
+	int i;
+	
+	for(i = 0; i < len; i++)
+	{
+		feedback = data[i] ^ vgetq_lane_u8(lo, 0);
 		
 		/* Shift */
-		memmove(&parity[0], &parity[1], sizeof(uint8_t) * (NROOTS - 1));
-		if(feedback != A0)
-			parity[NROOTS - 1] = ALPHA_TO[mod255(feedback + GENPOLY[0])];
-		else
-			parity[NROOTS - 1] = 0;
+		lo = vextq_u8(lo, hi, 1);
+		hi = vextq_u8(hi, vdupq_n_u8(0), 1);
+		
+		if(feedback == 0) continue;
+		
+		lo = veorq_u8(lo, veorq_u8(vld1q_u8(&GENPOLY32_LO[feedback & 0x0F][0]), vld1q_u8(&GENPOLY32_HI[feedback >> 4][0])));
+		hi = veorq_u8(hi, veorq_u8(vld1q_u8(&GENPOLY32_LO[feedback & 0x0F][16]), vld1q_u8(&GENPOLY32_HI[feedback >> 4][16])));
 	}
+	
+	vst1q_u8(&parity[0], lo);
+	vst1q_u8(&parity[16], hi);
 }
 
-int decode_rs_8(uint8_t *data, int *eras_pos, int no_eras, int pad)
+#endif
+
+/* XOR the sum of v[k] * c[k] into the 32 values in acc[] */
+static void gf_dot_c(uint8_t *acc, const uint8_t (*v)[32], const uint8_t *c, int n)
 {
-	int deg_lambda, el, deg_omega;
-	int i, j, r, k;
-	uint8_t u, q, tmp, num1, num2, den, discr_r;
-	uint8_t lambda[NROOTS + 1], s[NROOTS]; /* Err+Eras Locator poly
-	                                        * and syndrome poly */
-	uint8_t b[NROOTS + 1], t[NROOTS + 1], omega[NROOTS + 1];
-	uint8_t root[NROOTS], reg[NROOTS + 1], loc[NROOTS];
-	int syn_error, count;
+	int k, t;
 	
-	if(pad < 0 || pad > 222) return(-1);
+	for(k = 0; k < n; k++)
+	{
+		for(t = 0; t < 32; t++)
+			acc[t] ^= MUL_LO[c[k]][v[k][t] & 0x0F] ^ MUL_HI[c[k]][v[k][t] >> 4];
+	}
+}
+
+#ifdef RS8_X86
+
+__attribute__((target("ssse3")))
+static void gf_dot_ssse3(uint8_t *acc, const uint8_t (*v)[32], const uint8_t *c, int n)
+{
+	const __m128i mask = _mm_set1_epi8(0x0F);
+	__m128i a0, a1, tlo, thi, x;
+	int k;
 	
-	/* form the syndromes; i.e., evaluate data(x) at roots of g(x) */
-	for(i = 0; i < NROOTS; i++) s[i] = data[0];
+	a0 = _mm_loadu_si128((const __m128i *) &acc[0]);
+	a1 = _mm_loadu_si128((const __m128i *) &acc[16]);
 	
-	for(j = 1; j < NN - pad; j++)
+	for(k = 0; k < n; k++)
 	{
-		for(i = 0; i < NROOTS; i++)
-		{
-			if(s[i] == 0) s[i] = data[j];
-			else s[i] = data[j] ^ ALPHA_TO[MODNN(INDEX_OF[s[i]] + (FCR + i) * PRIM)];
-		}
+		tlo = _mm_loadu_si128((const __m128i *) MUL_LO[c[k]]);
+		thi = _mm_loadu_si128((const __m128i *) MUL_HI[c[k]]);
+		
+		x  = _mm_loadu_si128((const __m128i *) &v[k][0]);
+		a0 = _mm_xor_si128(a0, _mm_shuffle_epi8(tlo, _mm_and_si128(x, mask)));
+		a0 = _mm_xor_si128(a0, _mm_shuffle_epi8(thi, _mm_and_si128(_mm_srli_epi16(x, 4), mask)));
+		
+		x  = _mm_loadu_si128((const __m128i *) &v[k][16]);
+		a1 = _mm_xor_si128(a1, _mm_shuffle_epi8(tlo, _mm_and_si128(x, mask)));
+		a1 = _mm_xor_si128(a1, _mm_shuffle_epi8(thi, _mm_and_si128(_mm_srli_epi16(x, 4), mask)));
+	}
+	
+	_mm_storeu_si128((__m128i *) &acc[0], a0);
+	_mm_storeu_si128((__m128i *) &acc[16], a1);
+}
+
+__attribute__((target("avx2")))
+static void gf_dot_avx2(uint8_t *acc, const uint8_t (*v)[32], const uint8_t *c, int n)
+{
+	const __m256i mask = _mm256_set1_epi8(0x0F);
+	__m256i a, tlo, thi, x;
+	int k;
+	
+	a = _mm256_loadu_si256((const __m256i *) acc);
+	
+	for(k = 0; k < n; k++)
+	{
+		tlo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) MUL_LO[c[k]]));
+		thi = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) MUL_HI[c[k]]));
+		
+		x = _mm256_loadu_si256((const __m256i *) v[k]);
+		a = _mm256_xor_si256(a, _mm256_shuffle_epi8(tlo, _mm256_and_si256(x, mask)));
+		a = _mm256_xor_si256(a, _mm256_shuffle_epi8(thi, _mm256_and_si256(_mm256_srli_epi16(x, 4), mask)));
+	}
+	
+	_mm256_storeu_si256((__m256i *) acc, a);
+}
+
+#endif
+
+#ifdef RS8_NEON
+
+static void gf_dot_neon(uint8_t *acc, const uint8_t (*v)[32], const uint8_t *c, int n)
+{
+	const uint8x16_t mask = vdupq_n_u8(0x0F);
+	uint8x16_t a0, a1, tlo, thi, x;
+	int k;
+	
+	a0 = vld1q_u8(&acc[0]);
+	a1 = vld1q_u8(&acc[16]);
+	
+	for(k = 0; k < n; k++)
+	{
+		tlo = vld1q_u8(MUL_LO[c[k]]);
+		thi = vld1q_u8(MUL_HI[c[k]]);
+		
+		x  = vld1q_u8(&v[k][0]);
+		a0 = veorq_u8(a0, veorq_u8(vqtbl1q_u8(tlo, vandq_u8(x, mask)), vqtbl1q_u8(thi, vshrq_n_u8(x, 4))));
+		
+		x  = vld1q_u8(&v[k][16]);
+		a1 = veorq_u8(a1, veorq_u8(vqtbl1q_u8(tlo, vandq_u8(x, mask)), vqtbl1q_u8(thi, vshrq_n_u8(x, 4))));
+	}
+	
+	vst1q_u8(&acc[0], a0);
+	vst1q_u8(&acc[16], a1);
+}
+
+#endif
+
+/* Select the fastest kernels this CPU supports */
+enum { RS8_C = 0, RS8_SSSE3, RS8_AVX2, RS8_NEON_K };
+
+static int kernel;
+static pthread_once_t kernel_once = PTHREAD_ONCE_INIT;
+
+static void rs8_probe(void)
+{
+#if defined(RS8_X86)
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("avx2")) kernel = RS8_AVX2;
+	else if(__builtin_cpu_supports("ssse3")) kernel = RS8_SSSE3;
+	else kernel = RS8_C;
+#elif defined(RS8_NEON)
+	kernel = RS8_NEON_K;
+#else
+	kernel = RS8_C;
+#endif
+}
+
+/* Probed once, by whichever thread gets here first */
+static int rs8_kernel(void)
+{
+	pthread_once(&kernel_once, rs8_probe);
+	return(kernel);
+}
+
+/* The vector kernels hold a 32 byte parity register, other codes use C */
+static void rs_encode(int kernel, const rs8_code_t *code, uint8_t *data, uint8_t *parity, int len)
+{
+	switch(code->nroots == 32 ? kernel : RS8_C)
+	{
+#if defined(RS8_X86)
+	case RS8_AVX2:   encode_rs_8_avx2(data, parity, len); break;
+	case RS8_SSSE3:  encode_rs_8_ssse3(data, parity, len); break;
+#elif defined(RS8_NEON)
+	case RS8_NEON_K: encode_rs_8_neon(data, parity, len); break;
+#endif
+	default:         encode_rs_8_c(code, data, parity, len); break;
 	}
+}
+
+static void rs_dot(int kernel, uint8_t *acc, const uint8_t (*v)[32], const uint8_t *c, int n)
+{
+	switch(kernel)
+	{
+#if defined(RS8_X86)
+	case RS8_AVX2:   gf_dot_avx2(acc, v, c, n); break;
+	case RS8_SSSE3:  gf_dot_ssse3(acc, v, c, n); break;
+#elif defined(RS8_NEON)
+	case RS8_NEON_K: gf_dot_neon(acc, v, c, n); break;
+#endif
+	default:         gf_dot_c(acc, v, c, n); break;
+	}
+}
+
+static int rs_decode(const rs8_code_t *code, uint8_t *data, int *eras_pos, int no_eras, int pad)
+{
+	int deg_lambda, el, deg_omega;
+	int i, j, r, k;
+	uint8_t u, tmp, num1, num2, den, discr_r;
+	uint8_t lambda[MAX_ROOTS + 1], s[64]; /* Err+Eras Locator poly
+	                                       * and syndrome poly */
+	uint8_t b[MAX_ROOTS + 1], t[MAX_ROOTS + 1], omega[MAX_ROOTS + 1];
+	uint8_t root[MAX_ROOTS], loc[MAX_ROOTS];
+	uint8_t rem[MAX_ROOTS], q[32], c[MAX_ROOTS + 1];
+	int syn_error, count, kernel, nroots = code->nroots;
+	
+	if(pad < 0 || pad > NN - nroots - 1) return(-1);
+	
+	kernel = rs8_kernel();
+	
+	/* Divide data(x) by g(x), the remainder is zero only for a codeword */
+	rs_encode(kernel, code, data, rem, NN - nroots - pad);
 	
-	/* Convert syndromes to index form, checking for nonzero condition */
 	syn_error = 0;
-	for(i = 0; i < NROOTS; i++)
+	for(i = 0; i < nroots; i++)
 	{
-		syn_error |= s[i];
-		s[i] = INDEX_OF[s[i]];
+		rem[i] ^= data[NN - nroots - pad + i];
+		syn_error |= rem[i];
 	}
 	
 	if(!syn_error)
@@ -141,7 +1598,17 @@ int decode_rs_8(uint8_t *data, int *eras_pos, int no_eras, int pad)
 		goto finish;
 	}
 	
-	memset(&lambda[1], 0, NROOTS * sizeof(lambda[0]));
+	/* form the syndromes; i.e., evaluate the remainder at roots of g(x),
+	 * 32 at a time */
+	memset(s, 0, sizeof(s));
+	for(i = 0; i < nroots; i += 32)
+		rs_dot(kernel, &s[i], &code->syn_pow[i / 32 * nroots], rem, nroots);
+	
+	/* Convert syndromes to index form */
+	for(i = 0; i < nroots; i++)
+		s[i] = INDEX_OF[s[i]];
+	
+	memset(&lambda[1], 0, nroots * sizeof(lambda[0]));
 	lambda[0] = 1;
 	
 	if(no_eras > 0)
@@ -160,7 +1627,7 @@ int decode_rs_8(uint8_t *data, int *eras_pos, int no_eras, int pad)
 		
 	}
 	
-	for(i = 0; i < NROOTS + 1; i++)
+	for(i = 0; i < nroots + 1; i++)
 		b[i] = INDEX_OF[lambda[i]];
 	
 	/*
@@ -169,7 +1636,7 @@ int decode_rs_8(uint8_t *data, int *eras_pos, int no_eras, int pad)
 	 */
 	r = no_eras;
 	el = no_eras;
-	while(++r <= NROOTS) /* r is the step number */
+	while(++r <= nroots) /* r is the step number */
 	{
 		/* Compute discrepancy at the r-th step in poly-form */
 		discr_r = 0;
@@ -184,14 +1651,14 @@ int decode_rs_8(uint8_t *data, int *eras_pos, int no_eras, int pad)
 		if(discr_r == A0)
 		{
 			/* 2 lines below: B(x) <-- x*B(x) */
-			memmove(&b[1], b, NROOTS * sizeof(b[0]));
+			memmove(&b[1], b, nroots * sizeof(b[0]));
 			b[0] = A0;
 		}
 		else
 		{
 			/* 7 lines below: T(x) <-- lambda(x) - discr_r*x*b(x) */
 			t[0] = lambda[0];
-			for(i = 0; i < NROOTS; i++)
+			for(i = 0; i < nroots; i++)
 			{
 				if(b[i] != A0)
 					t[i + 1] = lambda[i + 1] ^ ALPHA_TO[MODNN(discr_r + b[i])];
@@ -206,52 +1673,52 @@ int decode_rs_8(uint8_t *data, int *eras_pos, int no_eras, int pad)
 				 * 2 lines below: B(x) <-- inv(discr_r) *
 				 * lambda(x)
 				 */
-				for(i = 0; i <= NROOTS; i++)
+				for(i = 0; i <= nroots; i++)
 					b[i] = (lambda[i] == 0) ? A0 : MODNN(INDEX_OF[lambda[i]] - discr_r + NN);
 			}
 			else
 			{
 				/* 2 lines below: B(x) <-- x*B(x) */
-				memmove(&b[1], b, NROOTS * sizeof(b[0]));
+				memmove(&b[1], b, nroots * sizeof(b[0]));
 				b[0] = A0;
 			}
 			
-			memcpy(lambda, t, (NROOTS + 1) * sizeof(t[0]));
+			memcpy(lambda, t, (nroots + 1) * sizeof(t[0]));
 		}
 	}
 	
 	/* Convert lambda to index form and compute deg(lambda(x)) */
 	deg_lambda = 0;
-	for(i = 0; i < NROOTS + 1; i++)
+	for(i = 0; i < nroots + 1; i++)
 	{
 		lambda[i] = INDEX_OF[lambda[i]];
 		if(lambda[i] != A0) deg_lambda = i;
 	}
 	
-	/* Find roots of the error+erasure locator polynomial by Chien search */
-	memcpy(&reg[1], &lambda[1], NROOTS * sizeof(reg[0]));
+	/* Find roots of the error+erasure locator polynomial by Chien search,
+	 * evaluating lambda(x) at 32 consecutive powers of alpha at a time */
 	count = 0; /* Number of roots of lambda(x) */
-	for(i = 1, k = IPRIM - 1; i <= NN; i++, k = MODNN(k + IPRIM))
+	for(r = 1; r <= NN && count < deg_lambda; r += 32)
 	{
-		q = 1; /* lambda[0] is always 0 */
-		for(j = deg_lambda; j > 0; j--)
-		{
-			if(reg[j] != A0)
-			{
-				reg[j] = MODNN(reg[j] + j);
-				q ^= ALPHA_TO[reg[j]];
-			}
-		}
+		memset(q, 1, sizeof(q)); /* lambda[0] is always 0 */
 		
-		if (q != 0) continue; /* Not a root */
+		for(j = 1; j <= deg_lambda; j++)
+			c[j] = (lambda[j] == A0) ? 0 : ALPHA_TO[MODNN(lambda[j] + j * r)];
 		
-		/* store root (index-form) and error location number */
-		root[count] = i;
-		loc[count] = k;
-		/* If we've already found max possible roots,
-		 * abort the search to save time
-		 */
-		if(++count == deg_lambda) break;
+		rs_dot(kernel, q, &CHIEN_POW[1], &c[1], deg_lambda);
+		
+		for(k = 0; k < 32 && r + k <= NN; k++)
+		{
+			if(q[k] != 0) continue; /* Not a root */
+			
+			/* store root (index-form) and error location number */
+			root[count] = r + k;
+			loc[count] = MODNN((r + k) * IPRIM - 1);
+			/* If we've already found max possible roots,
+			 * abort the search to save time
+			 */
+			if(++count == deg_lambda) break;
+		}
 	}
 	
 	if(deg_lambda != count)
@@ -266,7 +1733,7 @@ int decode_rs_8(uint8_t *data, int *eras_pos, int no_eras, int pad)
 	
 	/*
 	 * Compute err+eras evaluator poly omega(x) = s(x)*lambda(x) (modulo
-	 * x**NROOTS). in index form. Also find deg(omega).
+	 * x**nroots). in index form. Also find deg(omega).
 	 */
 	deg_omega = deg_lambda - 1;
 	for(i = 0; i <= deg_omega; i++)
@@ -291,11 +1758,11 @@ int decode_rs_8(uint8_t *data, int *eras_pos, int no_eras, int pad)
 		{
 			if(omega[i] != A0) num1 ^= ALPHA_TO[MODNN(omega[i] + i * root[j])];
 		}
-		num2 = ALPHA_TO[MODNN(root[j] * (FCR - 1) + NN)];
+		num2 = ALPHA_TO[MODNN(root[j] * (code->fcr - 1) + NN)];
 		den = 0;
 		
 		/* lambda[i+1] for i even is the formal derivative lambda_pr of lambda[i] */
-		for(i = MIN(deg_lambda, NROOTS - 1) & ~1; i >= 0; i -= 2)
+		for(i = MIN(deg_lambda, nroots - 1) & ~1; i >= 0; i -= 2)
 		{
 			if(lambda[i + 1] != A0) den ^= ALPHA_TO[MODNN(lambda[i + 1] + i * root[j])];
 		}
@@ -316,3 +1783,33 @@ finish:
 	return(count);
 }
 
+void encode_rs_8(uint8_t *data, uint8_t *parity, int pad)
+{
+	rs_encode(rs8_kernel(), &RS8_CODES[2], data, parity, NN - 32 - pad);
+}
+
+int decode_rs_8(uint8_t *data, int *eras_pos, int no_eras, int pad)
+{
+	return(rs_decode(&RS8_CODES[2], data, eras_pos, no_eras, pad));
+}
+
+int encode_rs_8n(uint8_t *data, uint8_t *parity, int pad, int nroots)
+{
+	const rs8_code_t *code = rs8_code(nroots);
+	
+	if(!code || pad < 0 || pad > NN - nroots - 1) return(-1);
+	
+	rs_encode(rs8_kernel(), code, data, parity, NN - nroots - pad);
+	
+	return(0);
+}
+
+int decode_rs_8n(uint8_t *data, int *eras_pos, int no_eras, int pad, int nroots)
+{
+	const rs8_code_t *code = rs8_code(nroots);
+	
+	if(!code) return(-1);
+	
+	return(rs_decode(code, data, eras_pos, no_eras, pad));
+}
+
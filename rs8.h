@@ -16,6 +16,10 @@ extern "C" {
 extern void encode_rs_8(uint8_t *data, uint8_t *parity, int pad);
 extern int decode_rs_8(uint8_t *data, int *eras_pos, int no_eras, int pad);
 
+/* As above with 8, 16, 32 or 48 parity symbols, -1 for any other number */
+extern int encode_rs_8n(uint8_t *data, uint8_t *parity, int pad, int nroots);
+extern int decode_rs_8n(uint8_t *data, int *eras_pos, int no_eras, int pad, int nroots);
+
 #ifdef __cplusplus
 }
 #endif
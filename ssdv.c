@@ -19,8 +19,10 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <string.h>
+#include <pthread.h>
 #include "ssdv.h"
 #include "rs8.h"
+#include "crc32.h"
 
 /* Recognised JPEG markers */
 enum {
@@ -111,15 +113,24 @@ static uint8_t const std_dht11[179] = {
 /* Helper for returning the current DHT table */
 #define SDHT (s->sdht[s->acpart ? 1 : 0][s->component ? 1 : 0])
 #define DDHT (s->ddht[s->acpart ? 1 : 0][s->component ? 1 : 0])
-
-/* Helpers for looking up the current DQT value */
-#define SDQT (s->sdqt[s->component ? 1 : 0][1 + s->acpart])
-#define DDQT (s->ddqt[s->component ? 1 : 0][1 + s->acpart])
+#define SHUFF (*s->shuff[s->acpart ? 1 : 0][s->component ? 1 : 0])
+#define DHCODE (*s->dhcode[s->acpart ? 1 : 0][s->component ? 1 : 0])
 
 /* Helpers for converting between DQT tables */
-#define AADJ(i) (SDQT == DDQT ? (i) : irdiv(i, DDQT))
-#define UADJ(i) (SDQT == DDQT ? (i) : (i * SDQT))
-#define BADJ(i) (SDQT == DDQT ? (i) : irdiv(i * SDQT, DDQT))
+#define AADJ(i) ssdv_requant(&s->rq, s->component ? 1 : 0, 0, i)
+#define BADJ(i) ssdv_requant(&s->rq, s->component ? 1 : 0, s->acpart, i)
+
+/* Number of bits needed to represent a positive value */
+static inline uint8_t bitwidth(uint32_t v)
+{
+#if defined(__GNUC__)
+	return(v ? 32 - __builtin_clz(v) : 0);
+#else
+	uint8_t w;
+	for(w = 0; v; v >>= 1) w++;
+	return(w);
+#endif
+}
 
 /* Integer-only division with rounding */
 static int irdiv(int i, int div)
@@ -129,6 +140,44 @@ static int irdiv(int i, int div)
 	return(i / 2);
 }
 
+/* Prepare the factors used by ssdv_requant(). For each part, the value
+ * is multiplied by the input DQT value and divided by the output one.
+ * Equal tables leave the value as is, and are marked to skip the work */
+static void ssdv_requant_init(ssdv_rq_t *rq, uint8_t *sdqt[2], uint8_t *ddqt[2])
+{
+	int t, k;
+	
+	for(t = 0; t < 2; t++)
+	{
+		rq->same[t] = 0;
+		if(!sdqt[t] || !ddqt[t]) continue;
+		
+		rq->same[t] = (memcmp(&sdqt[t][1], &ddqt[t][1], 64) == 0);
+		
+		for(k = 0; k < 64; k++)
+		{
+			rq->dq[t][k] = ddqt[t][1 + k];
+			rq->mul[t][k] = sdqt[t][1 + k];
+			rq->rcp[t][k] = ((1ULL << 31) + rq->dq[t][k] - 1) / rq->dq[t][k];
+		}
+	}
+}
+
+/* The same as irdiv(i * mul, dq) without dividing. This is exact
+ * while the doubled product is below 2^24, true for any 16-bit value */
+static inline int ssdv_requant(const ssdv_rq_t *rq, uint8_t t, uint8_t k, int i)
+{
+	uint32_t a = (i < 0 ? -i : i);
+	uint32_t n = 2 * a * rq->mul[t][k] + rq->dq[t][k];
+	uint32_t r;
+	
+	if(rq->same[t]) return(i);
+	if(a >= 0x8000) return(irdiv(i * rq->mul[t][k], rq->dq[t][k]));
+	
+	r = ((uint64_t) (n >> 1) * rq->rcp[t][k]) >> 31;
+	return(i < 0 ? -(int) r : (int) r);
+}
+
 /*
 static char *strbits(uint32_t value, uint8_t bits)
 {
@@ -213,23 +262,18 @@ static void *dtblcpy(ssdv_t *s, const void *src, size_t n)
 	return(r);
 }
 
-static uint32_t crc32(void *data, size_t length)
+/* Output the source image's DQT tables as they are, in place of the
+ * standard ones. A greyscale image keeps the standard colour table */
+static void ssdv_enc_source_dqt(ssdv_t *s)
 {
-	uint32_t crc, x;
-	uint8_t i, *d;
+	int t;
 	
-	for(d = data, crc = 0xFFFFFFFF; length; length--)
+	for(t = 0; t < 2; t++)
 	{
-		x = (crc ^ *(d++)) & 0xFF;
-		for(i = 8; i > 0; i--)
-		{
-			if(x & 1) x = (x >> 1) ^ 0xEDB88320;
-			else x >>= 1;
-		}
-		crc = (crc >> 8) ^ x;
+		if(s->sdqt[t]) memcpy(&s->ddqt[t][1], &s->sdqt[t][1], 64);
 	}
 	
-	return(crc ^ 0xFFFFFFFF);
+	ssdv_requant_init(&s->rq, s->sdqt, s->ddqt);
 }
 
 static uint32_t encode_callsign(char *callsign)
@@ -276,69 +320,347 @@ static char *decode_callsign(char *callsign, uint32_t code)
 	return(callsign);
 }
 
-static inline char jpeg_dht_lookup(ssdv_t *s, uint8_t *symbol, uint8_t *width)
+/* Build the lookup table for a DHT in 'lookup', or none if NULL */
+static void jpeg_dht_build(ssdv_huff_t *h, const uint8_t *dht, uint16_t *lookup)
 {
-	uint16_t code = 0;
-	uint8_t cw, n;
-	uint8_t *dht, *ss;
+	int32_t code = 0;
+	int cw, n, k = 0, i;
 	
-	/* Select the appropriate huffman table */
-	dht = SDHT;
-	ss = &dht[17];
+	if(lookup) memset(lookup, 0, sizeof(uint16_t) << SSDV_HUFF_LOOKAHEAD);
+	h->lookup = lookup;
+	h->symbols = &dht[17];
 	
 	for(cw = 1; cw <= 16; cw++)
 	{
-		/* Got enough bits? */
-		if(cw > s->worklen) return(SSDV_FEED_ME);
+		h->valoffset[cw] = k - code;
 		
-		/* Compare against each code 'cw' bits wide */
-		for(n = dht[cw]; n > 0; n--)
+		for(n = dht[cw]; n > 0; n--, k++, code++)
 		{
-			if(s->workbits >> (s->worklen - cw) == code)
+			/* Codes past the end of this length mean an invalid table */
+			if(!lookup || cw > SSDV_HUFF_LOOKAHEAD || code >= 1 << cw) continue;
+			
+			/* Fill every table entry that begins with this code */
+			for(i = 0; i < 1 << (SSDV_HUFF_LOOKAHEAD - cw); i++)
 			{
-				/* Found a match */
-				*symbol = *ss;
-				*width = cw;
-				return(SSDV_OK);
+				lookup[(code << (SSDV_HUFF_LOOKAHEAD - cw)) | i] = (cw << 8) | h->symbols[k];
 			}
-			ss++; code++;
 		}
 		
+		h->maxcode[cw] = dht[cw] ? code - 1 : -1;
 		code <<= 1;
 	}
 	
+	/* Sentinel, ensures the search ends */
+	h->maxcode[17] = 0x7FFFFFFF;
+}
+
+static inline char jpeg_dht_lookup(ssdv_t *s, uint8_t *symbol, uint8_t *width)
+{
+	const ssdv_huff_t *h;
+	uint16_t e = 0;
+	uint8_t cw;
+	int32_t code;
+	
+	/* Select the appropriate huffman table */
+	h = &SHUFF;
+	
+	/* Try the lookahead table first, padding short inputs with zeros */
+	if(!h->lookup) cw = 1;
+	else
+	{
+		if(s->worklen >= SSDV_HUFF_LOOKAHEAD)
+			e = h->lookup[(s->workbits >> (s->worklen - SSDV_HUFF_LOOKAHEAD)) & ((1 << SSDV_HUFF_LOOKAHEAD) - 1)];
+		else
+			e = h->lookup[(s->workbits << (SSDV_HUFF_LOOKAHEAD - s->worklen)) & ((1 << SSDV_HUFF_LOOKAHEAD) - 1)];
+		
+		cw = SSDV_HUFF_LOOKAHEAD + 1;
+	}
+	
+	if(e)
+	{
+		/* Got enough bits? */
+		if((e >> 8) > s->worklen) return(SSDV_FEED_ME);
+		
+		*symbol = e & 0xFF;
+		*width = e >> 8;
+		return(SSDV_OK);
+	}
+	
+	/* Longer codes, search the remaining code lengths */
+	for(; cw <= 16; cw++)
+	{
+		/* Got enough bits? */
+		if(cw > s->worklen) return(SSDV_FEED_ME);
+		
+		code = s->workbits >> (s->worklen - cw);
+		if(code <= h->maxcode[cw])
+		{
+			/* Found a match */
+			*symbol = h->symbols[h->valoffset[cw] + code];
+			*width = cw;
+			return(SSDV_OK);
+		}
+	}
+	
 	/* No match found - error */
 	return(SSDV_ERROR);
 }
 
-static inline char jpeg_dht_lookup_symbol(ssdv_t *s, uint8_t symbol, uint16_t *bits, uint8_t *width)
+static void jpeg_dht_build_codes(ssdv_hcode_t *h, const uint8_t *dht)
 {
 	uint16_t code = 0;
 	uint8_t cw, n;
-	uint8_t *dht, *ss;
+	const uint8_t *ss;
 	
-	dht = DDHT;
+	memset(h->width, 0, sizeof(h->width));
 	ss = &dht[17];
 	
 	for(cw = 1; cw <= 16; cw++)
 	{
 		for(n = dht[cw]; n > 0; n--)
 		{
-			if(*ss == symbol)
+			/* Keep the first code for each symbol */
+			if(h->width[*ss] == 0)
 			{
-				/* Found a match */
-				*bits = code;
-				*width = cw;
-				return(SSDV_OK);
+				h->code[*ss] = code;
+				h->width[*ss] = cw;
 			}
 			ss++; code++;
 		}
 		
 		code <<= 1;
 	}
+}
+
+/* Length of a DHT table, its ID, counts and symbols */
+static uint16_t jpeg_dht_length(const uint8_t *dht)
+{
+	uint16_t i, n = 17;
+	for(i = 1; i <= 16; i++) n += dht[i];
+	return(n);
+}
+
+/* Test a DHT table holds a valid canonical huffman code of no more
+ * than 256 symbols. With 'symbols' set, also test the DC symbols are
+ * sizes of up to 11 bits and the AC ones are valid run/size pairs */
+static char jpeg_dht_check(const uint8_t *dht, char symbols)
+{
+	int32_t code = 0;
+	int cw, i, n = 0;
+	uint8_t v;
+	
+	for(cw = 1; cw <= 16; cw++)
+	{
+		code += dht[cw];
+		n += dht[cw];
+		
+		/* More codes of this length than there is room for */
+		if(code > 1 << cw) return(SSDV_ERROR);
+		
+		code <<= 1;
+	}
 	
-	/* No match found - error */
-	return(SSDV_ERROR);
+	if(n > 256) return(SSDV_ERROR);
+	
+	for(i = 0; symbols && i < n; i++)
+	{
+		v = dht[17 + i];
+		
+		if(dht[0] >> 4)
+		{
+			/* EOB and ZRL are the only symbols with a size of 0 */
+			if((v & 0x0F) == 0 ? v != 0x00 && v != 0xF0 : (v & 0x0F) > 10) return(SSDV_ERROR);
+		}
+		else if(v > 11) return(SSDV_ERROR);
+	}
+	
+	return(SSDV_OK);
+}
+
+/* Build the optimal DHT table with ID 'id' for the symbol counts in
+ * 'count', codes limited to 16 bits as in JPEG Annex K.2. Returns its length */
+static uint16_t jpeg_dht_optimal(uint8_t *dht, uint8_t id, const uint32_t *count)
+{
+	uint32_t freq[257];
+	int size[257], next[257], bits[33];
+	int i, j, v1, v2, n = 17;
+
+	for(i = 0; i < 256; i++)
+	{
+		freq[i] = count[i];
+		size[i] = 0;
+		next[i] = -1;
+	}
+
+	/* A reserved symbol keeps any code from being all 1 bits */
+	freq[256] = 1;
+	size[256] = 0;
+	next[256] = -1;
+
+	while(1)
+	{
+		/* Find the two least frequent symbols */
+		for(v1 = v2 = -1, i = 0; i < 257; i++)
+		{
+			if(freq[i] == 0) continue;
+			if(v1 < 0 || freq[i] <= freq[v1]) { v2 = v1; v1 = i; }
+			else if(v2 < 0 || freq[i] <= freq[v2]) v2 = i;
+		}
+
+		if(v2 < 0) break;
+
+		/* Join them, making the codes of both one bit longer */
+		freq[v1] += freq[v2];
+		freq[v2] = 0;
+
+		for(size[v1]++; next[v1] >= 0; size[v1]++) v1 = next[v1];
+		next[v1] = v2;
+		for(size[v2]++; next[v2] >= 0; size[v2]++) v2 = next[v2];
+	}
+
+	memset(bits, 0, sizeof(bits));
+	for(i = 0; i < 257; i++) if(size[i]) bits[size[i]]++;
+
+	/* Shorten any codes longer than 16 bits */
+	for(i = 32; i > 16; i--)
+	{
+		while(bits[i] > 0)
+		{
+			for(j = i - 2; bits[j] == 0; j--);
+			bits[i] -= 2;
+			bits[i - 1]++;
+			bits[j + 1] += 2;
+			bits[j]--;
+		}
+	}
+
+	/* Remove the reserved symbol, it has the longest code */
+	for(i = 16; bits[i] == 0; i--);
+	bits[i]--;
+
+	/* The symbols in order of code length */
+	dht[0] = id;
+	for(i = 1; i <= 16; i++)
+	{
+		dht[i] = bits[i];
+		for(j = 0; j < 256; j++) if(size[j] == i) dht[n++] = j;
+	}
+
+	/* Symbols with codes that were shortened */
+	for(i = 17; i <= 32; i++)
+	{
+		for(j = 0; j < 256; j++) if(size[j] == i) dht[n++] = j;
+	}
+
+	return(n);
+}
+
+/* The standard DHT tables and their lookup tables, built once and shared */
+static const uint8_t *std_dht[2][2] = { { std_dht00, std_dht01 }, { std_dht10, std_dht11 } };
+static uint16_t std_lookup[2][2][1 << SSDV_HUFF_LOOKAHEAD];
+static ssdv_huff_t std_huff[2][2];
+static ssdv_hcode_t std_hcode[2][2];
+static pthread_once_t std_once = PTHREAD_ONCE_INIT;
+
+static void std_build(void)
+{
+	int c, t;
+	
+	for(c = 0; c < 2; c++)
+	{
+		for(t = 0; t < 2; t++)
+		{
+			jpeg_dht_build(&std_huff[c][t], std_dht[c][t], std_lookup[c][t]);
+			jpeg_dht_build_codes(&std_hcode[c][t], std_dht[c][t]);
+		}
+	}
+}
+
+/* Test if a DHT is the standard one with its ID */
+static char std_dht_is(const uint8_t *dht)
+{
+	const uint8_t *std = std_dht[dht[0] >> 4][dht[0] & 0x0F];
+	uint16_t l = jpeg_dht_length(dht);
+	
+	return(l == jpeg_dht_length(std) && memcmp(dht, std, l) == 0);
+}
+
+/* Use the shared lookup table for an input DHT if it is a standard one,
+ * otherwise build its own */
+static void sload_huff(ssdv_t *s, const uint8_t *dht)
+{
+	int c = dht[0] >> 4, t = dht[0] & 0x0F;
+	
+	if(std_dht_is(dht))
+	{
+		s->shuff[c][t] = &std_huff[c][t];
+		return;
+	}
+	
+	jpeg_dht_build(&s->huff[c][t], dht, s->huff_tables ? s->huff_tables->lookup[c][t] : NULL);
+	s->shuff[c][t] = &s->huff[c][t];
+}
+
+/* The same for the code table of an output DHT. The caller checks there
+ * is somewhere to build one that isn't standard */
+static void dload_hcode(ssdv_t *s, const uint8_t *dht)
+{
+	int c = dht[0] >> 4, t = dht[0] & 0x0F;
+	
+	if(std_dht_is(dht) || !s->huff_tables)
+	{
+		s->dhcode[c][t] = &std_hcode[c][t];
+		return;
+	}
+	
+	jpeg_dht_build_codes(&s->huff_tables->hcode[c][t], dht);
+	s->dhcode[c][t] = &s->huff_tables->hcode[c][t];
+}
+
+/* Replace the input DHT tables and build their lookup tables. Any
+ * DQT tables loaded since the DHT tables are dropped */
+static void sload_dht(ssdv_t *s, const uint8_t *dht00, const uint8_t *dht01, const uint8_t *dht10, const uint8_t *dht11)
+{
+	if(s->sdht[0][0]) s->stbl_len = s->sdht[0][0] - s->stbls;
+	
+	s->sdht[0][0] = stblcpy(s, dht00, jpeg_dht_length(dht00));
+	s->sdht[0][1] = stblcpy(s, dht01, jpeg_dht_length(dht01));
+	s->sdht[1][0] = stblcpy(s, dht10, jpeg_dht_length(dht10));
+	s->sdht[1][1] = stblcpy(s, dht11, jpeg_dht_length(dht11));
+	
+	sload_huff(s, s->sdht[0][0]);
+	sload_huff(s, s->sdht[0][1]);
+	sload_huff(s, s->sdht[1][0]);
+	sload_huff(s, s->sdht[1][1]);
+}
+
+/* The same for the output DHT tables and their code tables */
+static void dload_dht(ssdv_t *s, const uint8_t *dht00, const uint8_t *dht01, const uint8_t *dht10, const uint8_t *dht11)
+{
+	if(s->ddht[0][0]) s->dtbl_len = s->ddht[0][0] - s->dtbls;
+	
+	s->ddht[0][0] = dtblcpy(s, dht00, jpeg_dht_length(dht00));
+	s->ddht[0][1] = dtblcpy(s, dht01, jpeg_dht_length(dht01));
+	s->ddht[1][0] = dtblcpy(s, dht10, jpeg_dht_length(dht10));
+	s->ddht[1][1] = dtblcpy(s, dht11, jpeg_dht_length(dht11));
+	
+	dload_hcode(s, s->ddht[0][0]);
+	dload_hcode(s, s->ddht[0][1]);
+	dload_hcode(s, s->ddht[1][0]);
+	dload_hcode(s, s->ddht[1][1]);
+}
+
+static inline char jpeg_dht_lookup_symbol(ssdv_t *s, uint8_t symbol, uint16_t *bits, uint8_t *width)
+{
+	const ssdv_hcode_t *h = &DHCODE;
+	
+	/* Symbol not in the table - error */
+	if(h->width[symbol] == 0) return(SSDV_ERROR);
+	
+	*bits = h->code[symbol];
+	*width = h->width[symbol];
+	
+	return(SSDV_OK);
 }
 
 static inline int jpeg_int(int bits, int width)
@@ -354,7 +676,7 @@ static inline void jpeg_encode_int(int value, int *bits, uint8_t *width)
 	
 	/* Calculate the number of bits */
 	if(value < 0) value = -value;
-	for(*width = 0; value; value >>= 1) (*width)++;
+	*width = bitwidth(value);
 	
 	/* Fix negative values */
 	if(*bits < 0) *bits = -*bits ^ ((1 << *width) - 1);
@@ -362,19 +684,28 @@ static inline void jpeg_encode_int(int value, int *bits, uint8_t *width)
 
 /*****************************************************************************/
 
-static char ssdv_outbits(ssdv_t *s, uint16_t bits, uint8_t length)
+static char ssdv_out_drain(ssdv_t *s)
 {
-	uint8_t b;
+	size_t length = s->outp - s->out;
 	
-	if(length)
-	{
-		s->outbits <<= length;
-		s->outbits |= bits & ((1 << length) - 1);
-		s->outlen += length;
-	}
+	if(!s->sink) return(SSDV_BUFFER_FULL);
+	
+	/* Pass the buffer contents to the sink and start again */
+	if(length) s->sink(s->out, length, s->sink_user);
+	s->outp = s->out;
+	s->out_len += length;
+	
+	return(SSDV_OK);
+}
+
+static void ssdv_outbits_flush(ssdv_t *s)
+{
+	uint8_t b;
 	
-	while(s->outlen >= 8 && s->out_len > 0)
+	while(s->outlen >= 8)
 	{
+		if(s->out_len == 0 && ssdv_out_drain(s) != SSDV_OK) break;
+		
 		b = s->outbits >> (s->outlen - 8);
 		
 		/* Put the byte into the output buffer */
@@ -385,10 +716,45 @@ static char ssdv_outbits(ssdv_t *s, uint16_t bits, uint8_t length)
 		/* Insert stuffing byte if needed */
 		if(s->out_stuff && b == 0xFF)
 		{
-			s->outbits &= (1 << s->outlen) - 1;
+			s->outbits &= ((uint64_t) 1 << s->outlen) - 1;
 			s->outlen += 8;
 		}
 	}
+}
+
+static char ssdv_outbits(ssdv_t *s, uint16_t bits, uint8_t length)
+{
+	uint32_t w;
+	
+	/* Write out whole words while the accumulator is half full */
+	while(s->outlen >= 32 && s->out_len >= 4)
+	{
+		w = s->outbits >> (s->outlen - 32);
+		
+		/* Write a byte at a time if any byte is 0xFF and needs stuffing */
+		if(s->out_stuff && ((~w - 0x01010101) & w & 0x80808080))
+		{
+			ssdv_outbits_flush(s);
+			break;
+		}
+		
+		s->outp[0] = w >> 24;
+		s->outp[1] = w >> 16;
+		s->outp[2] = w >> 8;
+		s->outp[3] = w;
+		s->outp += 4;
+		s->outlen -= 32;
+		s->out_len -= 4;
+	}
+	
+	if(length)
+	{
+		if(s->outlen + length > 64) ssdv_outbits_flush(s);
+		
+		s->outbits <<= length;
+		s->outbits |= bits & ((1 << length) - 1);
+		s->outlen += length;
+	}
 	
 	return(s->out_len ? SSDV_OK : SSDV_BUFFER_FULL);
 }
@@ -396,8 +762,12 @@ static char ssdv_outbits(ssdv_t *s, uint16_t bits, uint8_t length)
 static char ssdv_outbits_sync(ssdv_t *s)
 {
 	uint8_t b = s->outlen % 8;
-	if(b) return(ssdv_outbits(s, 0xFF, 8 - b));
-	return(SSDV_OK);
+	if(b) ssdv_outbits(s, 0xFF, 8 - b);
+	
+	/* Write out all the whole bytes */
+	ssdv_outbits_flush(s);
+	
+	return(s->out_len ? SSDV_OK : SSDV_BUFFER_FULL);
 }
 
 static char ssdv_out_jpeg_int(ssdv_t *s, uint8_t rle, int value)
@@ -511,7 +881,7 @@ static char ssdv_process(ssdv_t *s)
 				if(s->mode == S_ENCODING)
 				{
 					/* Output absolute DC value */
-					s->dc[s->component] += UADJ(i);
+					s->dc[s->component] += i;
 					s->adc[s->component] = AADJ(s->dc[s->component]);
 					ssdv_out_jpeg_int(s, 0, s->adc[s->component]);
 				}
@@ -526,13 +896,13 @@ static char ssdv_process(ssdv_t *s)
 			{
 				if(s->mode == S_DECODING)
 				{
-					s->dc[s->component] += UADJ(i);
+					s->dc[s->component] += i;
 					ssdv_out_jpeg_int(s, 0, i);
 				}
 				else
 				{
 					/* Output relative DC value */
-					s->dc[s->component] += UADJ(i);
+					s->dc[s->component] += i;
 					
 					/* Calculate closest adjusted DC value */
 					i = AADJ(s->dc[s->component]);
@@ -632,24 +1002,152 @@ static char ssdv_process(ssdv_t *s)
 		s->accrle = 0;
 	}
 	
-	if(s->out_len == 0) return(SSDV_BUFFER_FULL);
+	/* Pending bytes (and their stuffing) may fill the buffer, write them out */
+	if(s->out_len <= s->outlen / 4) ssdv_outbits_flush(s);
+	
+	if(s->out_len == 0) return(ssdv_out_drain(s));
 	
 	return(SSDV_OK);
 }
 
+/* Reed-Solomon parity bytes for each strength of a normal packet. The
+ * default is first so those packets keep their original type byte */
+static const uint8_t ssdv_rs_strengths[4] = { SSDV_PKT_SIZE_RSCODES, 8, 16, 48 };
+
+static inline int ssdv_rs_roots(uint8_t type_byte)
+{
+	/* Parity bytes of a packet by its type byte, 0 for no-FEC packets
+	 * or -1 if it isn't a known type */
+	uint8_t t = type_byte - 0x66;
+	
+	if(t > (SSDV_TYPE_REPAIR | SSDV_TYPE_RS | SSDV_TYPE_TABLES | SSDV_TYPE_NOFEC)) return(-1);
+	if((t & SSDV_TYPE_REPAIR) && (t & SSDV_TYPE_TABLES)) return(-1);
+	if(t & SSDV_TYPE_NOFEC) return(t & SSDV_TYPE_RS ? -1 : 0);
+	
+	return(ssdv_rs_strengths[(t & SSDV_TYPE_RS) >> 2]);
+}
+
+/* Packets longer than SSDV_PKT_SIZE have one more header byte, the high
+ * byte of the MCU offset */
+static inline int ssdv_pkt_size_header(int pkt_size)
+{
+	return(pkt_size > SSDV_PKT_SIZE ? SSDV_PKT_SIZE_HEADER_WIDE : SSDV_PKT_SIZE_HEADER);
+}
+
+/* Packets too long for one Reed-Solomon codeword are split between several,
+ * the bytes after the sync byte dealt out to each in turn. Each codeword
+ * ends with its RS codes, so they are all together at the end */
+static inline int ssdv_rs_codewords(int pkt_size)
+{
+	return((pkt_size - 1 + 254) / 255);
+}
+
+static inline int ssdv_pkt_size_payload(int pkt_size, int rs_roots)
+{
+	return(pkt_size - ssdv_pkt_size_header(pkt_size) - SSDV_PKT_SIZE_CRC - ssdv_rs_codewords(pkt_size) * rs_roots);
+}
+
+static inline uint16_t ssdv_pkt_mcu_offset(uint8_t *packet, int pkt_size)
+{
+	if(pkt_size > SSDV_PKT_SIZE) return((packet[15] << 8) | packet[12]);
+	return(packet[12]);
+}
+
+static void ssdv_rs_encode(uint8_t *packet, int pkt_size, int rs_roots)
+{
+	uint8_t cw[255], *d = &packet[1];
+	int n, l, c, i, j;
+	
+	n = ssdv_rs_codewords(pkt_size);
+	l = pkt_size - 1;
+	
+	if(n == 1)
+	{
+		encode_rs_8n(d, &d[l - rs_roots], 256 - pkt_size, rs_roots);
+		return;
+	}
+	
+	for(c = 0; c < n; c++)
+	{
+		/* Gather the data of codeword c, encode and scatter the codes */
+		l = (pkt_size - 1 - c + n - 1) / n;
+		for(i = 0, j = c; i < l - rs_roots; i++, j += n) cw[i] = d[j];
+		encode_rs_8n(cw, &cw[i], 255 - l, rs_roots);
+		for(; i < l; i++, j += n) d[j] = cw[i];
+	}
+}
+
+static int ssdv_rs_erasures(uint8_t *confidence, int c, int n, int l, int rs_roots, int erase, int *eras)
+{
+	uint16_t w[255];
+	int i, j, k, e;
+	
+	/* Erase the bytes of codeword c with no confidence, then the 'erase'
+	 * least confident, up to as many as the codes can correct. The
+	 * positions count from the start of the padded codeword */
+	for(k = i = 0, j = c; i < l; i++, j += n)
+	{
+		w[i] = confidence[j];
+		if(w[i] == 0) k++;
+	}
+	
+	k += erase;
+	if(k > rs_roots) k = rs_roots;
+	
+	for(e = 0; e < k; e++)
+	{
+		for(j = 0, i = 1; i < l; i++) if(w[i] < w[j]) j = i;
+		
+		eras[e] = 255 - l + j;
+		w[j] = 0x100;
+	}
+	
+	return(e);
+}
+
+static int ssdv_rs_decode(uint8_t *packet, int pkt_size, int rs_roots, uint8_t *confidence, int erase)
+{
+	uint8_t cw[255], *d = &packet[1], *p;
+	int eras[255];
+	int n, l, c, i, j, r, e, errors;
+	
+	n = ssdv_rs_codewords(pkt_size);
+	p = (n == 1 ? d : cw);
+	
+	for(errors = c = 0; c < n; c++)
+	{
+		l = (pkt_size - 1 - c + n - 1) / n;
+		if(n > 1) for(i = 0, j = c; i < l; i++, j += n) cw[i] = d[j];
+		
+		/* The confidence of each byte, less the sync byte */
+		e = (confidence ? ssdv_rs_erasures(&confidence[1], c, n, l, rs_roots, erase, eras) : 0);
+		
+		r = decode_rs_8n(p, e ? eras : 0, e, 255 - l, rs_roots);
+		if(r < 0) return(-1);
+		errors += r;
+		
+		if(n == 1 || r == 0) continue;
+		for(i = 0, j = c; i < l; i++, j += n) d[j] = cw[i];
+	}
+	
+	return(errors);
+}
+
 static void ssdv_set_packet_conf(ssdv_t *s)
 {
 	/* Configure the payload size and CRC position */
+	s->pkt_size_header = ssdv_pkt_size_header(s->pkt_size);
+	
 	switch(s->type)
 	{
 	case SSDV_TYPE_NORMAL:
-		s->pkt_size_payload = s->pkt_size - SSDV_PKT_SIZE_HEADER - SSDV_PKT_SIZE_CRC - SSDV_PKT_SIZE_RSCODES;
-		s->pkt_size_crcdata = SSDV_PKT_SIZE_HEADER + s->pkt_size_payload - 1;
+		s->pkt_size_payload = ssdv_pkt_size_payload(s->pkt_size, ssdv_rs_strengths[s->rs >> 2]);
+		s->pkt_size_crcdata = s->pkt_size_header + s->pkt_size_payload - 1;
 		break;
 	
 	case SSDV_TYPE_NOFEC:
-		s->pkt_size_payload = s->pkt_size - SSDV_PKT_SIZE_HEADER - SSDV_PKT_SIZE_CRC;
-		s->pkt_size_crcdata = SSDV_PKT_SIZE_HEADER + s->pkt_size_payload - 1;
+		s->pkt_size_payload = ssdv_pkt_size_payload(s->pkt_size, 0);
+		s->pkt_size_crcdata = s->pkt_size_header + s->pkt_size_payload - 1;
 		break;
 	}
 }
@@ -848,6 +1346,8 @@ static char ssdv_have_marker_data(ssdv_t *s)
 			return(SSDV_ERROR);
 		}
 		
+		if(s->tables & SSDV_TABLES_DQT) ssdv_enc_source_dqt(s);
+		
 		if(!s->sdht[0][0] || (d[0] > 1 && !s->sdht[0][1]) ||
 		   !s->sdht[1][0] || (d[0] > 1 && !s->sdht[1][1]))
 		{
@@ -855,6 +1355,8 @@ static char ssdv_have_marker_data(ssdv_t *s)
 			return(SSDV_ERROR);
 		}
 		
+		ssdv_requant_init(&s->rq, s->sdqt, s->ddqt);
+		
 		/* The SOS data is followed by the image data */
 		s->state = S_HUFF;
 		
@@ -866,14 +1368,6 @@ static char ssdv_have_marker_data(ssdv_t *s)
 		{
 			int i, j;
 			
-			switch(d[0])
-			{
-			case 0x00: s->sdht[0][0] = d; break;
-			case 0x01: s->sdht[0][1] = d; break;
-			case 0x10: s->sdht[1][0] = d; break;
-			case 0x11: s->sdht[1][1] = d; break;
-			}
-			
 			/* Skip to the next DHT table */
 			for(j = 17, i = 1; i <= 16; i++)
 				j += d[i];
@@ -884,6 +1378,20 @@ static char ssdv_have_marker_data(ssdv_t *s)
 				fprintf(stderr, "The image has an invalid marker length\n");
 				return(SSDV_ERROR);
 			}
+			
+			if(jpeg_dht_check(d, 0) != SSDV_OK)
+			{
+				fprintf(stderr, "The image has an invalid huffman table\n");
+				return(SSDV_ERROR);
+			}
+			
+			switch(d[0])
+			{
+			case 0x00: s->sdht[0][0] = d; sload_huff(s, d); break;
+			case 0x01: s->sdht[0][1] = d; sload_huff(s, d); break;
+			case 0x10: s->sdht[1][0] = d; sload_huff(s, d); break;
+			case 0x11: s->sdht[1][1] = d; sload_huff(s, d); break;
+			}
 			d += j;
 		}
 		break;
@@ -919,6 +1427,119 @@ static char ssdv_have_marker_data(ssdv_t *s)
 	return(SSDV_OK);
 }
 
+static char ssdv_marker_byte(ssdv_t *s, uint8_t b)
+{
+	int r;
+	
+	switch(s->state)
+	{
+	case S_MARKER:
+		s->marker = (s->marker << 8) | b;
+		
+		if(s->marker == J_TEM ||
+		   (s->marker >= J_RST0 && s->marker <= J_EOI))
+		{
+			/* Marker without data */
+			s->marker_len = 0;
+			r = ssdv_have_marker(s);
+			if(r != SSDV_OK) return(r);
+		}
+		else if(s->marker >= J_SOF0 && s->marker <= J_COM)
+		{
+			/* All other markers are followed by data */
+			s->marker_len = 0;
+			s->state = S_MARKER_LEN;
+			s->needbits = 16;
+		}
+		break;
+	
+	case S_MARKER_LEN:
+		s->marker_len = (s->marker_len << 8) | b;
+		if((s->needbits -= 8) == 0)
+		{
+			s->marker_len -= 2;
+			r = ssdv_have_marker(s);
+			if(r != SSDV_OK) return(r);
+		}
+		break;
+	
+	case S_MARKER_DATA:
+		s->marker_data[s->marker_data_len++] = b;
+		if(s->marker_data_len == s->marker_len)
+		{
+			r = ssdv_have_marker_data(s);
+			if(r != SSDV_OK) return(r);
+		}
+		break;
+	
+	default:
+		break;
+	}
+	
+	return(SSDV_OK);
+}
+
+static void ssdv_enc_header(ssdv_t *s, uint8_t *out, uint16_t packet_id, char eoi, uint16_t mcu_id, uint16_t mcu_offset)
+{
+	out[0]   = 0x55;                /* Sync */
+	out[1]   = 0x66 + (s->type | s->rs); /* Type */
+	out[2]   = s->callsign >> 24;
+	out[3]   = s->callsign >> 16;
+	out[4]   = s->callsign >> 8;
+	out[5]   = s->callsign;
+	out[6]   = s->image_id;         /* Image ID */
+	out[7]   = packet_id >> 8;      /* Packet ID MSB */
+	out[8]   = packet_id & 0xFF;    /* Packet ID LSB */
+	out[9]   = s->width >> 4;       /* Width / 16 */
+	out[10]  = s->height >> 4;      /* Height / 16 */
+	out[11]  = 0x00;
+	out[11] |= (s->tables & 3) << 6; /* Tables flags (2 bits) */
+	out[11] |= ((s->quality - 4) & 7) << 3;  /* Quality level */
+	out[11] |= (eoi ? 1 : 0) << 2;  /* EOI flag (1 bit) */
+	out[11] |= s->mcu_mode & 0x03;  /* MCU mode (2 bits) */
+	out[12]  = mcu_offset & 0xFF;   /* Next MCU offset */
+	out[13]  = mcu_id >> 8;         /* MCU ID MSB */
+	out[14]  = mcu_id & 0xFF;       /* MCU ID LSB */
+	
+	if(s->pkt_size > SSDV_PKT_SIZE)
+	{
+		out[15] = mcu_offset >> 8;  /* Next MCU offset MSB */
+	}
+}
+
+static void ssdv_enc_seal_packet(ssdv_t *s, uint8_t *out, size_t used)
+{
+	uint32_t x;
+	int i;
+	
+	/* Fill any remaining bytes with noise */
+	if(used < s->pkt_size_payload)
+	{
+		ssdv_memset_prng(&out[s->pkt_size_header + used], s->pkt_size_payload - used);
+	}
+	
+	/* Calculate the CRC codes */
+	x = ssdv_crc32(&out[1], s->pkt_size_crcdata);
+	
+	i = 1 + s->pkt_size_crcdata;
+	out[i++] = (x >> 24) & 0xFF;
+	out[i++] = (x >> 16) & 0xFF;
+	out[i++] = (x >> 8) & 0xFF;
+	out[i++] = x & 0xFF;
+	
+	/* Generate the RS codes */
+	if(s->type == SSDV_TYPE_NORMAL)
+	{
+		ssdv_rs_encode(out, s->pkt_size, ssdv_rs_strengths[s->rs >> 2]);
+	}
+}
+
+static void ssdv_enc_finish_packet(ssdv_t *s, uint8_t *out, uint16_t packet_id, char eoi, uint16_t mcu_id, uint16_t mcu_offset, size_t used)
+{
+	ssdv_enc_header(s, out, packet_id, eoi, mcu_id, mcu_offset);
+	ssdv_enc_seal_packet(s, out, used);
+}
+
 char ssdv_enc_init(ssdv_t *s, uint8_t type, char *callsign, uint8_t image_id, int8_t quality, int pkt_size)
 {
 	/* Limit the quality level */
@@ -926,13 +1547,15 @@ char ssdv_enc_init(ssdv_t *s, uint8_t type, char *callsign, uint8_t image_id, in
 	if(quality > 7) quality = 7;
 	
 	/* Limit the packet length */
-	if(pkt_size > SSDV_PKT_SIZE ||
-	   pkt_size - SSDV_PKT_SIZE_HEADER - SSDV_PKT_SIZE_CRC - (type == SSDV_TYPE_NORMAL ? SSDV_PKT_SIZE_RSCODES : 0) < 2)
+	if(pkt_size > SSDV_PKT_SIZE_MAX ||
+	   ssdv_pkt_size_payload(pkt_size, type == SSDV_TYPE_NORMAL ? SSDV_PKT_SIZE_RSCODES : 0) < 2)
 	{
 		fprintf(stderr, "Invalid SSDV packet length\n");
 		return(SSDV_ERROR);
 	}
 	
+	pthread_once(&std_once, std_build);
+	
 	memset(s, 0, sizeof(ssdv_t));
 	s->image_id = image_id;
 	s->callsign = encode_callsign(callsign);
@@ -945,10 +1568,89 @@ char ssdv_enc_init(ssdv_t *s, uint8_t type, char *callsign, uint8_t image_id, in
 	/* Prepare the output JPEG tables */
 	s->ddqt[0] = dload_standard_dqt(s, std_dqt0, s->quality);
 	s->ddqt[1] = dload_standard_dqt(s, std_dqt1, s->quality);
-	s->ddht[0][0] = dtblcpy(s, std_dht00, sizeof(std_dht00));
-	s->ddht[0][1] = dtblcpy(s, std_dht01, sizeof(std_dht01));
-	s->ddht[1][0] = dtblcpy(s, std_dht10, sizeof(std_dht10));
-	s->ddht[1][1] = dtblcpy(s, std_dht11, sizeof(std_dht11));
+	dload_dht(s, std_dht00, std_dht01, std_dht10, std_dht11);
+	
+	return(SSDV_OK);
+}
+
+char ssdv_enc_set_quality(ssdv_t *s, int8_t quality)
+{
+	/* The quality can't change once packets have been made */
+	if(s->packet_id > 0) return(SSDV_ERROR);
+	
+	/* Limit the quality level */
+	if(quality < 0) quality = 0;
+	if(quality > 7) quality = 7;
+	
+	/* The standard tables replace any from the source image */
+	s->tables &= ~SSDV_TABLES_DQT;
+	s->quality = quality;
+	load_standard_dqt(s->ddqt[0], std_dqt0, s->quality);
+	load_standard_dqt(s->ddqt[1], std_dqt1, s->quality);
+	ssdv_requant_init(&s->rq, s->sdqt, s->ddqt);
+	
+	return(SSDV_OK);
+}
+
+char ssdv_enc_set_source_dqt(ssdv_t *s)
+{
+	/* The tables can't change once packets have been made */
+	if(s->packet_id > 0) return(SSDV_ERROR);
+	
+	s->tables |= SSDV_TABLES_DQT;
+	
+	/* Use them now if they have been read already */
+	if(s->sdqt[0]) ssdv_enc_source_dqt(s);
+	
+	return(SSDV_OK);
+}
+
+char ssdv_enc_set_fec(ssdv_t *s, int rs_roots)
+{
+	uint8_t rs;
+	
+	/* The payload size can't change once a buffer is set */
+	if(s->packet_id > 0 || s->out) return(SSDV_ERROR);
+	
+	for(rs = 0; rs < 4 && ssdv_rs_strengths[rs] != rs_roots; rs++);
+	
+	if(rs == 4 || s->type != SSDV_TYPE_NORMAL ||
+	   ssdv_pkt_size_payload(s->pkt_size, rs_roots) < 2)
+	{
+		fprintf(stderr, "Invalid number of Reed-Solomon codes for this packet type or length\n");
+		return(SSDV_ERROR);
+	}
+	
+	s->rs = rs << 2;
+	ssdv_set_packet_conf(s);
+	
+	return(SSDV_OK);
+}
+
+char ssdv_enc_set_repair(ssdv_t *s, int group, int repairs)
+{
+	uint8_t rs;
+	
+	/* The repair packets are a Reed-Solomon code, with the strengths
+	 * of a normal packet */
+	for(rs = 0; rs < 4 && ssdv_rs_strengths[rs] != repairs; rs++);
+	
+	if(rs == 4 || group < 1 || group + repairs > 255)
+	{
+		fprintf(stderr, "Invalid number of repair packets for this group size\n");
+		return(SSDV_ERROR);
+	}
+	
+	s->repair_group = group;
+	s->repairs = repairs;
+	
+	return(SSDV_OK);
+}
+
+char ssdv_enc_set_huff_tables(ssdv_t *s, ssdv_huff_tables_t *tables)
+{
+	/* Used for any of the image's tables that aren't standard */
+	s->huff_tables = tables;
 	
 	return(SSDV_OK);
 }
@@ -956,18 +1658,64 @@ char ssdv_enc_init(ssdv_t *s, uint8_t type, char *callsign, uint8_t image_id, in
 char ssdv_enc_set_buffer(ssdv_t *s, uint8_t *buffer)
 {
 	s->out     = buffer;
-	s->outp    = buffer + SSDV_PKT_SIZE_HEADER;
+	s->outp    = buffer + s->pkt_size_header;
 	s->out_len = s->pkt_size_payload;
 	
 	/* Zero the payload memory */
 	memset(s->out, 0, s->pkt_size);
 	
 	/* Flush the output bits */
-	ssdv_outbits(s, 0, 0);
+	ssdv_outbits_flush(s);
 	
 	return(SSDV_OK);
 }
 
+static char ssdv_enc_process(ssdv_t *s)
+{
+	int r;
+	
+	/* Process the new data until more needed, or an error occurs */
+	while((r = ssdv_process(s)) == SSDV_OK);
+	
+	if(r == SSDV_BUFFER_FULL || r == SSDV_EOI)
+	{
+		uint16_t mcu_id     = s->packet_mcu_id;
+		uint16_t mcu_offset = s->packet_mcu_offset;
+		
+		if(mcu_offset != 0xFFFF && mcu_offset >= s->pkt_size_payload)
+		{
+			/* The first MCU begins in the next packet, not this one */
+			mcu_id = 0xFFFF;
+			mcu_offset = 0xFFFF;
+			s->packet_mcu_offset -= s->pkt_size_payload;
+		}
+		else
+		{
+			/* Clear the MCU data for the next packet */
+			s->packet_mcu_id = 0xFFFF;
+			s->packet_mcu_offset = 0xFFFF;
+		}
+		
+		/* A packet is ready, create the headers */
+		ssdv_enc_finish_packet(s, s->out, s->packet_id, r == SSDV_EOI, mcu_id, mcu_offset, s->pkt_size_payload - s->out_len);
+		
+		s->packet_id++;
+		
+		/* Have we reached the end of the image data? */
+		if(r == SSDV_EOI) s->state = S_EOI;
+		
+		return(SSDV_OK);
+	}
+	else if(r != SSDV_FEED_ME)
+	{
+		/* An error occured */
+		fprintf(stderr, "ssdv_process() failed: %i\n", r);
+		return(SSDV_ERROR);
+	}
+	
+	return(SSDV_FEED_ME);
+}
+
 char ssdv_enc_get_packet(ssdv_t *s)
 {
 	int r;
@@ -979,6 +1727,14 @@ char ssdv_enc_get_packet(ssdv_t *s)
 	/* If the output buffer is empty, re-initialise */
 	if(s->out_len == 0) ssdv_enc_set_buffer(s, s->out);
 	
+	/* Bits left over from the last packet may complete an MCU
+	 * before a reset marker, process them before reading on */
+	if(s->state == S_HUFF || s->state == S_INT)
+	{
+		r = ssdv_enc_process(s);
+		if(r != SSDV_FEED_ME) return(r);
+	}
+	
 	while(s->in_len)
 	{
 		b = *(s->inp++);
@@ -990,42 +1746,10 @@ char ssdv_enc_get_packet(ssdv_t *s)
 		switch(s->state)
 		{
 		case S_MARKER:
-			s->marker = (s->marker << 8) | b;
-			
-			if(s->marker == J_TEM ||
-			   (s->marker >= J_RST0 && s->marker <= J_EOI))
-			{
-				/* Marker without data */
-				s->marker_len = 0;
-				r = ssdv_have_marker(s);
-				if(r != SSDV_OK) return(r);
-			}
-			else if(s->marker >= J_SOF0 && s->marker <= J_COM)
-			{
-				/* All other markers are followed by data */
-				s->marker_len = 0;
-				s->state = S_MARKER_LEN;
-				s->needbits = 16;
-			}
-			break;
-		
 		case S_MARKER_LEN:
-			s->marker_len = (s->marker_len << 8) | b;
-			if((s->needbits -= 8) == 0)
-			{
-				s->marker_len -= 2;
-				r = ssdv_have_marker(s);
-				if(r != SSDV_OK) return(r);
-			}
-			break;
-		
 		case S_MARKER_DATA:
-			s->marker_data[s->marker_data_len++] = b;
-			if(s->marker_data_len == s->marker_len)
-			{
-				r = ssdv_have_marker_data(s);
-				if(r != SSDV_OK) return(r);
-			}
+			r = ssdv_marker_byte(s, b);
+			if(r != SSDV_OK) return(r);
 			break;
 		
 		case S_HUFF:
@@ -1038,81 +1762,8 @@ char ssdv_enc_get_packet(ssdv_t *s)
 			s->workbits = (s->workbits << 8) | b;
 			s->worklen += 8;
 			
-			/* Process the new data until more needed, or an error occurs */
-			while((r = ssdv_process(s)) == SSDV_OK);
-			
-			if(r == SSDV_BUFFER_FULL || r == SSDV_EOI)
-			{
-				uint16_t mcu_id    = s->packet_mcu_id;
-				uint8_t mcu_offset = s->packet_mcu_offset;
-				uint32_t x;
-				uint8_t i;
-				
-				if(mcu_offset != 0xFF && mcu_offset >= s->pkt_size_payload)
-				{
-					/* The first MCU begins in the next packet, not this one */
-					mcu_id = 0xFFFF;
-					mcu_offset = 0xFF;
-					s->packet_mcu_offset -= s->pkt_size_payload;
-				}
-				else
-				{
-					/* Clear the MCU data for the next packet */
-					s->packet_mcu_id = 0xFFFF;
-					s->packet_mcu_offset = 0xFF;
-				}
-				
-				/* A packet is ready, create the headers */
-				s->out[0]   = 0x55;                /* Sync */
-				s->out[1]   = 0x66 + s->type;      /* Type */
-				s->out[2]   = s->callsign >> 24;
-				s->out[3]   = s->callsign >> 16;
-				s->out[4]   = s->callsign >> 8;
-				s->out[5]   = s->callsign;
-				s->out[6]   = s->image_id;         /* Image ID */
-				s->out[7]   = s->packet_id >> 8;   /* Packet ID MSB */
-				s->out[8]   = s->packet_id & 0xFF; /* Packet ID LSB */
-				s->out[9]   = s->width >> 4;       /* Width / 16 */
-				s->out[10]  = s->height >> 4;      /* Height / 16 */
-				s->out[11]  = 0x00;
-				s->out[11] |= ((s->quality - 4) & 7) << 3;  /* Quality level */
-				s->out[11] |= (r == SSDV_EOI ? 1 : 0) << 2; /* EOI flag (1 bit) */
-				s->out[11] |= s->mcu_mode & 0x03;  /* MCU mode (2 bits) */
-				s->out[12]  = mcu_offset;          /* Next MCU offset */
-				s->out[13]  = mcu_id >> 8;         /* MCU ID MSB */
-				s->out[14]  = mcu_id & 0xFF;       /* MCU ID LSB */
-				
-				/* Fill any remaining bytes with noise */
-				if(s->out_len > 0) ssdv_memset_prng(s->outp, s->out_len);
-				
-				/* Calculate the CRC codes */
-				x = crc32(&s->out[1], s->pkt_size_crcdata);
-				
-				i = 1 + s->pkt_size_crcdata;
-				s->out[i++] = (x >> 24) & 0xFF;
-				s->out[i++] = (x >> 16) & 0xFF;
-				s->out[i++] = (x >> 8) & 0xFF;
-				s->out[i++] = x & 0xFF;
-				
-				/* Generate the RS codes */
-				if(s->type == SSDV_TYPE_NORMAL)
-				{
-					encode_rs_8(&s->out[1], &s->out[i], SSDV_PKT_SIZE - s->pkt_size);
-				}
-				
-				s->packet_id++;
-				
-				/* Have we reached the end of the image data? */
-				if(r == SSDV_EOI) s->state = S_EOI;
-				
-				return(SSDV_OK);
-			}
-			else if(r != SSDV_FEED_ME)
-			{
-				/* An error occured */
-				fprintf(stderr, "ssdv_process() failed: %i\n", r);
-				return(SSDV_ERROR);
-			}
+			r = ssdv_enc_process(s);
+			if(r != SSDV_FEED_ME) return(r);
 			break;
 		
 		case S_EOI:
@@ -1132,86 +1783,1014 @@ char ssdv_enc_feed(ssdv_t *s, uint8_t *buffer, size_t length)
 	return(SSDV_OK);
 }
 
-/*****************************************************************************/
-
-static void ssdv_write_marker(ssdv_t *s, uint16_t id, uint16_t length, const uint8_t *data)
+char ssdv_enc_image(ssdv_t *s, uint8_t *jpeg, size_t length, uint8_t *packets, int max_packets, int *count)
 {
-	ssdv_outbits(s, id, 16);
-	if(length > 0)
+	char r;
+	
+	/* The whole image is read in place. A NULL jpeg continues
+	 * from where the last call stopped with SSDV_BUFFER_FULL */
+	if(jpeg) ssdv_enc_feed(s, jpeg, length);
+	
+	for(*count = 0; *count < max_packets; (*count)++)
 	{
-		ssdv_outbits(s, length + 2, 16);
-		while(length--) ssdv_outbits(s, *(data++), 8);
+		ssdv_enc_set_buffer(s, &packets[s->pkt_size * *count]);
+		
+		r = ssdv_enc_get_packet(s);
+		
+		if(r == SSDV_EOI) return(SSDV_OK);
+		else if(r == SSDV_FEED_ME)
+		{
+			fprintf(stderr, "Premature end of file\n");
+			return(SSDV_ERROR);
+		}
+		else if(r != SSDV_OK) return(r);
 	}
+	
+	/* Out of space, is there more to come? */
+	return(s->state == S_EOI ? SSDV_OK : SSDV_BUFFER_FULL);
 }
 
-static void ssdv_out_headers(ssdv_t *s)
+/*****************************************************************************/
+
+/* How each block of the plan ends, after its last non-zero value: the
+ * number of ZRL codes the source image had there and if an EOB follows */
+#define PLAN_ZRL (0x07)
+#define PLAN_EOB (0x08)
+
+/* Largest possible MCU, six blocks of full width values */
+#define PLAN_MCU_MAX ((6 * (27 + 63 * 26) + 7) / 8)
+
+/* Smallest payload for which the plan matches the sequential encoder */
+#define PLAN_MIN_PAYLOAD (8)
+
+/* Length in bits of a value and its huffman code */
+static inline uint8_t ssdv_plan_width(ssdv_t *s, uint8_t ac, uint8_t component, uint8_t rle, int value)
 {
-	uint8_t *b = &s->stbls[s->stbl_len];
-	
-	ssdv_write_marker(s, J_SOI,    0, 0);
-	ssdv_write_marker(s, J_APP0,  14, app0);
-	ssdv_write_marker(s, J_DQT,   65, s->ddqt[0]);  /* DQT Luminance       */
-	ssdv_write_marker(s, J_DQT,   65, s->ddqt[1]);  /* DQT Chrominance     */
-	
-	/* Build SOF0 header */
-	b[0]  = 8; /* Precision */
-	b[1]  = s->height >> 8;
-	b[2]  = s->height & 0xFF;
-	b[3]  = s->width >> 8;
-	b[4]  = s->width & 0xFF;
-	b[5]  = 3; /* Components (Y'Cb'Cr) */
-	b[6]  = 1; /* Y */
-	switch(s->mcu_mode)
-	{
-	case 0: b[7] = 0x22; break;
-	case 1: b[7] = 0x12; break;
-	case 2: b[7] = 0x21; break;
-	case 3: b[7] = 0x11; break;
-	}
-	b[8]  = 0x00;
-	b[9]  = 2; /* Cb */
-	b[10] = 0x11;
-	b[11] = 0x01;
-	b[12] = 3; /* Cr */
-	b[13] = 0x11;
-	b[14] = 0x01;
-	ssdv_write_marker(s, J_SOF0,  15, b);  /* SOF0 (Baseline DCT) */
+	uint8_t w = bitwidth(value < 0 ? -value : value);
+	return(s->dhcode[ac][component ? 1 : 0]->width[(rle << 4) | (w & 0x0F)] + w);
+}
+
+/* The index of an MCU's block 'part' within the store of its component */
+static inline size_t ssdv_plan_block(ssdv_t *s, uint16_t mcu, int part)
+{
+	return(part < s->ycparts ? (size_t) mcu * s->ycparts + part : mcu);
+}
+
+/* The requantised DC value of a block, 0 before the first */
+static inline int ssdv_plan_adc(ssdv_t *s, ssdv_plan_t *p, const ssdv_rq_t *rq, uint8_t component, size_t block)
+{
+	/* Greyscale images have no colour table, their colour blocks are empty */
+	if(block == (size_t) -1 || (component && s->greyscale)) return(0);
 	
-	ssdv_write_marker(s, J_DHT,   29, std_dht00); /* DHT (DC Luminance)  */
-	ssdv_write_marker(s, J_DHT,  179, std_dht10); /* DHT (AC Luminance)  */
-	ssdv_write_marker(s, J_DHT,   29, std_dht01); /* DHT (DC Chrominance */
-	ssdv_write_marker(s, J_DHT,  179, std_dht11); /* DHT (AC Chrominance */
-	ssdv_write_marker(s, J_SOS,   10, sos);
+	return(ssdv_requant(rq, component ? 1 : 0, 0, p->coef[component][block * 64]));
 }
 
-static void ssdv_fill_gap(ssdv_t *s, uint16_t next_mcu)
+/* Read the next step of the scan into the plan, storing the source values.
+ * The DC values are kept as ssdv_process() accumulates them */
+static char ssdv_plan_process(ssdv_t *s, ssdv_plan_t *p)
 {
-	if(s->mcupart > 0 || s->acpart > 0)
+	size_t block = ssdv_plan_block(s, s->mcu_id, s->mcupart);
+	int16_t *coef = &p->coef[s->component][block * 64];
+	uint8_t *ends = &p->ends[s->component][block];
+	
+	if(s->state == S_HUFF)
 	{
-		/* Cleanly end the current MCU part */
-		if(s->acpart > 0)
-		{
-			ssdv_out_jpeg_int(s, 0, 0);
-			s->mcupart++;
-		}
+		uint8_t symbol, width;
+		int r;
 		
-		/* End the current MCU block */
-		for(; s->mcupart < s->ycparts + 2; s->mcupart++)
+		/* Lookup the code, return if error or not enough bits yet */
+		if((r = jpeg_dht_lookup(s, &symbol, &width)) != SSDV_OK)
 		{
-			if(s->mcupart < s->ycparts) s->component = 0;
-			else s->component = s->mcupart - s->ycparts + 1;
-			s->acpart = 0; ssdv_out_jpeg_int(s, 0, 0); /* DC */
-			s->acpart = 1; ssdv_out_jpeg_int(s, 0, 0); /* AC */
+			return(r);
 		}
 		
-		s->mcu_id++;
-	}
-	
-	/* Pad out missing MCUs */
-	for(; s->mcu_id < next_mcu; s->mcu_id++)
-	{
-		/* End the current MCU block */
-		for(s->mcupart = 0; s->mcupart < s->ycparts + 2; s->mcupart++)
+		if(s->acpart == 0) /* DC */
+		{
+			/* A new block */
+			memset(coef, 0, sizeof(int16_t) * 64);
+			*ends = 0;
+			
+			if(symbol == 0x00)
+			{
+				/* No change in DC from last block. This follows the
+				 * requantised value, which isn't reset by a RST marker */
+				coef[0] = (block > 0 ? coef[-64] : 0);
+				s->acpart++;
+			}
+			else
+			{
+				/* DC value follows, 'symbol' bits wide */
+				s->state = S_INT;
+				s->needbits = symbol;
+			}
+		}
+		else /* AC */
+		{
+			s->acrle = 0;
+			if(symbol == 0x00)
+			{
+				/* EOB -- all remaining AC parts are zero */
+				*ends |= PLAN_EOB;
+				s->acpart = 64;
+			}
+			else if(symbol == 0xF0)
+			{
+				/* The next 16 AC parts are zero */
+				(*ends)++;
+				s->acpart += 16;
+			}
+			else
+			{
+				/* Next bits are an integer value */
+				s->state = S_INT;
+				s->acrle = symbol >> 4;
+				s->acpart += s->acrle;
+				s->needbits = symbol & 0x0F;
+			}
+		}
+		
+		/* Clear processed bits */
+		s->worklen -= width;
+		s->workbits &= (1 << s->worklen) - 1;
+	}
+	else if(s->state == S_INT)
+	{
+		int i;
+		
+		/* Not enough bits yet? */
+		if(s->worklen < s->needbits) return(SSDV_FEED_ME);
+		
+		/* Decode the integer */
+		i = jpeg_int(s->workbits >> (s->worklen - s->needbits), s->needbits);
+		
+		if(s->acpart == 0) /* DC */
+		{
+			s->dc[s->component] += i;
+			coef[0] = s->dc[s->component];
+		}
+		else /* AC */
+		{
+			if(s->acpart < 64) coef[s->acpart] = i;
+			*ends = 0;
+		}
+		
+		/* Next AC part to expect */
+		s->acpart++;
+		
+		/* Next bits are a huffman code */
+		s->state = S_HUFF;
+		
+		/* Clear processed bits */
+		s->worklen -= s->needbits;
+		s->workbits &= (1 << s->worklen) - 1;
+	}
+	
+	if(s->acpart >= 64)
+	{
+		s->mcupart++;
+		
+		if(s->greyscale && s->mcupart == s->ycparts)
+		{
+			/* For greyscale input images, pad the 2x1 MCUs with empty colour blocks */
+			for(; s->mcupart < s->ycparts + 2; s->mcupart++)
+			{
+				block = ssdv_plan_block(s, s->mcu_id, s->mcupart);
+				memset(&p->coef[s->mcupart - s->ycparts + 1][block * 64], 0, sizeof(int16_t) * 64);
+				p->ends[s->mcupart - s->ycparts + 1][block] = PLAN_EOB;
+			}
+		}
+		
+		/* Reached the end of this MCU */
+		if(s->mcupart == s->ycparts + 2)
+		{
+			s->mcupart = 0;
+			s->mcu_id++;
+			
+			/* Test for the end of image */
+			if(s->mcu_id >= s->mcu_count) return(SSDV_EOI);
+			
+			/* Test for a reset marker */
+			if(s->dri > 0 && s->mcu_id % s->dri == 0)
+			{
+				s->state = S_MARKER;
+				return(SSDV_FEED_ME);
+			}
+		}
+		
+		if(s->mcupart < s->ycparts) s->component = 0;
+		else s->component = s->mcupart - s->ycparts + 1;
+		
+		s->acpart = 0;
+		s->accrle = 0;
+	}
+	
+	return(SSDV_OK);
+}
+
+/* Find the parts of a block with non-zero AC values, returns how many */
+static int ssdv_plan_values(const int16_t *coef, uint8_t *pos)
+{
+	int k, n;
+	
+	for(n = 0, k = 1; k < 64; k++)
+	{
+		if(coef[k]) pos[n++] = k;
+	}
+	
+	return(n);
+}
+
+/* Requantise the 'n' AC values of a block at 'pos' with 'rq', adding
+ * their length to 'bits'. The codes are counted as the sequential encoder
+ * outputs them, the ZRL codes of the source image included. With 'store'
+ * set the block is replaced by the requantised one, and with 'rq' NULL
+ * it already has been. Returns the length of the last step
+ * ssdv_process() would take for the block */
+static uint8_t ssdv_plan_requant_ac(ssdv_t *s, const ssdv_rq_t *rq, uint8_t component, int16_t *coef, const uint8_t *pos, int n, uint8_t *ends, uint16_t *bits, char store)
+{
+	uint8_t t = (component ? 1 : 0);
+	uint8_t step = 0, zrl = 0, eob = *ends & PLAN_EOB;
+	int j, k, last = 0, run, accrle = 0, i;
+	
+	for(j = 0; j < n; j++)
+	{
+		k = pos[j];
+		run = k - last - 1;
+		last = k;
+		
+		/* The source ZRL codes before the value */
+		for(; run >= 16; run -= 16, zrl++)
+		{
+			step = ssdv_plan_width(s, 1, component, 15, 0);
+			*bits += step;
+		}
+		
+		i = (rq ? ssdv_requant(rq, t, k, coef[k]) : coef[k]);
+		if(store) coef[k] = i;
+		
+		if(i)
+		{
+			accrle += run;
+			for(step = 0; accrle >= 16; accrle -= 16)
+			{
+				step += ssdv_plan_width(s, 1, component, 15, 0);
+			}
+			step += ssdv_plan_width(s, 1, component, accrle, i);
+			*bits += step;
+			accrle = 0;
+			zrl = 0;
+		}
+		else if(k == 63)
+		{
+			/* The last value got reduced to 0, an EOB is output instead */
+			step = ssdv_plan_width(s, 1, component, 0, 0);
+			*bits += step;
+			eob = PLAN_EOB;
+		}
+		else accrle += run + 1;
+	}
+	
+	/* The source ZRL and EOB codes after the last value */
+	for(k = *ends & PLAN_ZRL; k > 0; k--, zrl++)
+	{
+		step = ssdv_plan_width(s, 1, component, 15, 0);
+		*bits += step;
+	}
+	
+	if(*ends & PLAN_EOB)
+	{
+		step = ssdv_plan_width(s, 1, component, 0, 0);
+		*bits += step;
+	}
+	
+	if(store) *ends = zrl | eob;
+	
+	return(step);
+}
+
+/* Find the length of an MCU requantised with each of the 'levels' tables
+ * in 'rq', in bits and with absolute DC values, and the length of its
+ * last step. With 'store' set the MCU is replaced by the requantised one.
+ * With 'rq' NULL the stored MCU is measured as it is */
+static void ssdv_plan_cost(ssdv_t *s, ssdv_plan_t *p, const ssdv_rq_t *rq, int levels, uint16_t mcu, char store, uint16_t *bits, uint16_t *abits, uint8_t *tail)
+{
+	uint8_t pos[63];
+	size_t block;
+	int16_t *coef;
+	uint8_t component, w;
+	int part, adc, n, q;
+	
+	for(q = 0; q < levels; q++) bits[q] = abits[q] = tail[q] = 0;
+	
+	for(part = 0; part < s->ycparts + 2; part++)
+	{
+		if(s->greyscale && part >= s->ycparts)
+		{
+			/* The empty colour blocks of a greyscale image are output
+			 * in the same step as the end of the last Y block */
+			w = ssdv_plan_width(s, 0, 1, 0, 0) + ssdv_plan_width(s, 1, 1, 0, 0);
+			for(q = 0; q < levels; q++)
+			{
+				tail[q] += w;
+				bits[q] += w;
+			}
+			continue;
+		}
+		
+		component = (part < s->ycparts ? 0 : part - s->ycparts + 1);
+		block = ssdv_plan_block(s, mcu, part);
+		coef = &p->coef[component][block * 64];
+		n = ssdv_plan_values(coef, pos);
+		
+		for(q = 0; q < levels; q++)
+		{
+			/* DC, absolute for the first block of each component in a reset MCU */
+			adc = ssdv_plan_adc(s, p, rq ? &rq[q] : &s->rq, component, block);
+			w = ssdv_plan_width(s, 0, component, 0, adc - ssdv_plan_adc(s, p, rq ? &rq[q] : &s->rq, component, block - 1));
+			bits[q] += w;
+			
+			if(part == 0 || part >= s->ycparts) abits[q] += ssdv_plan_width(s, 0, component, 0, adc) - w;
+			
+			/* AC */
+			tail[q] = ssdv_plan_requant_ac(s, rq ? &rq[q] : NULL, component, coef, pos, n, &p->ends[component][block], &bits[q], store);
+		}
+	}
+	
+	for(q = 0; q < levels; q++) abits[q] += bits[q];
+}
+
+char ssdv_enc_plan_rows(ssdv_t *s, ssdv_plan_t *p, int first, int count)
+{
+	uint32_t mcu, end;
+	
+	if(first < 0 || count < 0 || first + count > p->rows) return(SSDV_ERROR);
+	
+	mcu = (uint32_t) first * p->row_mcus;
+	end = (uint32_t) (first + count) * p->row_mcus;
+	if(end > s->mcu_count) end = s->mcu_count;
+	
+	for(; mcu < end; mcu++)
+	{
+		ssdv_plan_cost(s, p, &s->rq, 1, mcu, 1, &p->bits[mcu], &p->abits[mcu], &p->tail[mcu]);
+	}
+	
+	return(SSDV_OK);
+}
+
+/* The packet data laid out so far */
+typedef struct {
+	uint32_t b;      /* Length in bits                              */
+	uint32_t packet; /* The packet the last MCU ended in            */
+	uint32_t marked; /* The last packet given an MCU ID and offset  */
+	uint8_t reset;   /* Set if the next MCU begins with absolute DC */
+} ssdv_place_t;
+
+/* Add an MCU to the packet data as the sequential encoder would */
+static void ssdv_plan_place(ssdv_place_t *l, uint32_t pb, uint16_t bits, uint16_t abits, uint8_t tail)
+{
+	l->b += (l->reset ? abits : bits);
+	
+	/* The packet being filled when the last code of the MCU was output */
+	l->packet = (l->b - tail) / pb;
+	
+	/* The first MCU to begin after one ends in a packet without one
+	 * is byte aligned, and carries the packet's MCU ID and offset */
+	l->reset = (l->packet != l->marked);
+	if(l->reset)
+	{
+		l->b = (l->b + 7) & ~7;
+		l->marked = l->b / pb;
+	}
+}
+
+char ssdv_enc_plan_layout(ssdv_t *s, ssdv_plan_t *p)
+{
+	ssdv_place_t l = { 0, 0, 0, 1 };
+	uint32_t pb = s->pkt_size_payload * 8;
+	int m;
+	
+	for(m = 0; m < s->mcu_count; m++)
+	{
+		p->pos[m] = l.b;
+		p->reset[m] = l.reset;
+		ssdv_plan_place(&l, pb, p->bits[m], p->abits[m], p->tail[m]);
+	}
+	
+	/* Anything beyond the last packet is lost */
+	p->length = (l.b + 7) & ~7;
+	if(p->length > (l.packet + 1) * pb) p->length = (l.packet + 1) * pb;
+	p->pos[s->mcu_count] = p->length;
+	p->packets = l.packet + 1;
+	
+	return(SSDV_OK);
+}
+
+char ssdv_enc_plan_estimate(ssdv_t *s, ssdv_plan_t *p, int packets[8])
+{
+	uint8_t dqt[8][2][65], *ddqt[2];
+	ssdv_rq_t rq[8];
+	ssdv_place_t l[8];
+	uint32_t pb = s->pkt_size_payload * 8;
+	uint16_t bits[8], abits[8];
+	uint8_t tail[8];
+	int q, m;
+	
+	/* The tables for each quality level */
+	for(q = 0; q < 8; q++)
+	{
+		load_standard_dqt(dqt[q][0], std_dqt0, q);
+		load_standard_dqt(dqt[q][1], std_dqt1, q);
+		ddqt[0] = dqt[q][0];
+		ddqt[1] = dqt[q][1];
+		ssdv_requant_init(&rq[q], s->sdqt, ddqt);
+		
+		l[q].b = l[q].packet = l[q].marked = 0;
+		l[q].reset = 1;
+	}
+	
+	/* Lay out the packets for every level in one pass over the image */
+	for(m = 0; m < s->mcu_count; m++)
+	{
+		ssdv_plan_cost(s, p, rq, 8, m, 0, bits, abits, tail);
+		for(q = 0; q < 8; q++) ssdv_plan_place(&l[q], pb, bits[q], abits[q], tail[q]);
+	}
+	
+	for(q = 0; q < 8; q++) packets[q] = l[q].packet + 1;
+	
+	return(SSDV_OK);
+}
+
+/* Count the huffman symbols of each table in the requantised image */
+static void ssdv_plan_symbols(ssdv_t *s, ssdv_plan_t *p, uint32_t count[2][2][256])
+{
+	size_t block;
+	int16_t *coef;
+	uint8_t ends, t, w;
+	int mcu, part, component, k, run, dc;
+	
+	memset(count, 0, sizeof(uint32_t) * 2 * 2 * 256);
+	
+	for(mcu = 0; mcu < s->mcu_count; mcu++)
+	{
+		for(part = 0; part < s->ycparts + 2; part++)
+		{
+			component = (part < s->ycparts ? 0 : part - s->ycparts + 1);
+			t = (component ? 1 : 0);
+			
+			if(s->greyscale && component)
+			{
+				/* An empty colour block */
+				count[0][1][0x00]++;
+				count[1][1][0x00]++;
+				continue;
+			}
+			
+			block = ssdv_plan_block(s, mcu, part);
+			coef = &p->coef[component][block * 64];
+			ends = p->ends[component][block];
+			
+			/* DC */
+			dc = ssdv_plan_adc(s, p, &s->rq, component, block) - ssdv_plan_adc(s, p, &s->rq, component, block - 1);
+			w = bitwidth(dc < 0 ? -dc : dc);
+			if(w <= 11) count[0][t][w]++;
+			
+			/* AC */
+			for(run = 0, k = 1; k < 64; k++)
+			{
+				if(coef[k] == 0) { run++; continue; }
+				
+				for(; run >= 16; run -= 16) count[1][t][0xF0]++;
+				w = bitwidth(coef[k] < 0 ? -coef[k] : coef[k]);
+				if(w <= 10) count[1][t][(run << 4) | w]++;
+				run = 0;
+			}
+			
+			count[1][t][0xF0] += ends & PLAN_ZRL;
+			if(ends & PLAN_EOB) count[1][t][0x00]++;
+		}
+	}
+	
+	/* Any DC value can begin a reset MCU, and the decoder
+	 * fills gaps in the image with empty blocks */
+	for(t = 0; t < 2; t++)
+	{
+		for(k = 0; k <= 11; k++) count[0][t][k]++;
+		count[1][t][0x00]++;
+	}
+}
+
+/* Find the length of each MCU again after the output tables change */
+static void ssdv_plan_recount(ssdv_t *s, ssdv_plan_t *p)
+{
+	int m;
+	
+	for(m = 0; m < s->mcu_count; m++)
+	{
+		ssdv_plan_cost(s, p, NULL, 1, m, 0, &p->bits[m], &p->abits[m], &p->tail[m]);
+	}
+	
+	ssdv_enc_plan_layout(s, p);
+}
+
+/* The packets needed for the image, with table packets every 'repeat' packets */
+static int ssdv_plan_total(ssdv_t *s, ssdv_plan_t *p, int repeat)
+{
+	int sets = (repeat > 0 ? 1 + (p->packets - 1) / repeat : 1);
+	return(p->packets + sets * ssdv_enc_table_packets(s));
+}
+
+char ssdv_enc_plan_optimise(ssdv_t *s, ssdv_plan_t *p, int repeat)
+{
+	uint32_t count[2][2][256];
+	uint8_t dht[2][2][179];
+	int packets, c, t;
+	
+	/* The packets needed with the standard tables */
+	ssdv_enc_plan_layout(s, p);
+	packets = ssdv_plan_total(s, p, repeat);
+	
+	/* Nowhere to build the code tables for the image's own */
+	if(!s->huff_tables) return(SSDV_OK);
+	
+	/* Build the tables from the symbols the image uses */
+	ssdv_plan_symbols(s, p, count);
+	for(c = 0; c < 2; c++)
+	{
+		for(t = 0; t < 2; t++) jpeg_dht_optimal(dht[c][t], (c << 4) | t, count[c][t]);
+	}
+	
+	dload_dht(s, dht[0][0], dht[0][1], dht[1][0], dht[1][1]);
+	s->tables |= SSDV_TABLES_DHT;
+	ssdv_plan_recount(s, p);
+	
+	/* Keep them only if the image is smaller, table packets included */
+	if(ssdv_plan_total(s, p, repeat) >= packets)
+	{
+		dload_dht(s, std_dht00, std_dht01, std_dht10, std_dht11);
+		s->tables &= ~SSDV_TABLES_DHT;
+		ssdv_plan_recount(s, p);
+	}
+	
+	return(SSDV_OK);
+}
+
+/* Write out the tables sent in table packets, returns their length */
+static uint16_t ssdv_enc_tables(ssdv_t *s, uint8_t *b)
+{
+	uint16_t n = 0, l;
+	int c, t;
+	
+	for(c = 0; c < 2 && (s->tables & SSDV_TABLES_DQT); c++)
+	{
+		b[n++] = J_DQT & 0xFF;
+		memcpy(&b[n], s->ddqt[c], 65);
+		n += 65;
+	}
+	
+	for(c = 0; c < 2 && (s->tables & SSDV_TABLES_DHT); c++)
+	{
+		for(t = 0; t < 2; t++)
+		{
+			l = jpeg_dht_length(s->ddht[c][t]);
+			b[n++] = J_DHT & 0xFF;
+			memcpy(&b[n], s->ddht[c][t], l);
+			n += l;
+		}
+	}
+	
+	return(n);
+}
+
+int ssdv_enc_table_packets(ssdv_t *s)
+{
+	uint8_t b[SSDV_TABLES_LEN];
+	
+	if(!s->tables) return(0);
+	
+	/* Each packet begins with the total length of the tables */
+	return((ssdv_enc_tables(s, b) + s->pkt_size_payload - 3) / (s->pkt_size_payload - 2));
+}
+
+char ssdv_enc_table_packet(ssdv_t *s, int index, uint8_t *packet)
+{
+	uint8_t b[SSDV_TABLES_LEN];
+	uint16_t length, offset, n;
+	
+	if(index < 0 || index >= ssdv_enc_table_packets(s)) return(SSDV_ERROR);
+	
+	length = ssdv_enc_tables(s, b);
+	offset = index * (s->pkt_size_payload - 2);
+	n = length - offset;
+	if(n > s->pkt_size_payload - 2) n = s->pkt_size_payload - 2;
+	
+	/* The packet ID is the index of the table packet */
+	memset(packet, 0, s->pkt_size);
+	ssdv_enc_header(s, packet, index, 0, 0xFFFF, 0xFFFF);
+	packet[1] += SSDV_TYPE_TABLES;
+	
+	packet[s->pkt_size_header] = length >> 8;
+	packet[s->pkt_size_header + 1] = length & 0xFF;
+	memcpy(&packet[s->pkt_size_header + 2], &b[offset], n);
+	ssdv_enc_seal_packet(s, packet, n + 2);
+	
+	return(SSDV_OK);
+}
+
+char ssdv_enc_repair_packets(ssdv_t *s, uint8_t *packets, int count, uint8_t *repair)
+{
+	uint8_t cw[255], *p;
+	int rs, i, j, c, l;
+	
+	if(s->repairs == 0 || count < 1 || count > s->repair_group) return(SSDV_ERROR);
+	
+	for(rs = 0; ssdv_rs_strengths[rs] != s->repairs; rs++);
+	
+	/* The repair packets have the image header of the first packet in
+	 * the group, its size and the strength and index of the repair */
+	for(j = 0; j < s->repairs; j++)
+	{
+		p = &repair[s->pkt_size * j];
+		memcpy(p, packets, 9);
+		p[1] += SSDV_TYPE_REPAIR;
+		p[9] = count;
+		p[10] = (rs << 6) | j;
+	}
+	
+	/* The header up to byte 11 is the same for every packet in the group
+	 * but the packet ID, so each byte after it is coded across the group:
+	 * the packets are the data of the RS codeword, the repairs its codes */
+	l = s->pkt_size_header + s->pkt_size_payload;
+	for(c = 11; c < l; c++)
+	{
+		for(i = 0; i < count; i++) cw[i] = packets[s->pkt_size * i + c];
+		encode_rs_8n(cw, &cw[count], 255 - count - s->repairs, s->repairs);
+		for(j = 0; j < s->repairs; j++) repair[s->pkt_size * j + c] = cw[count + j];
+	}
+	
+	for(j = 0; j < s->repairs; j++)
+	{
+		ssdv_enc_seal_packet(s, &repair[s->pkt_size * j], s->pkt_size_payload);
+	}
+	
+	return(SSDV_OK);
+}
+
+static size_t ssdv_plan_bytes(ssdv_t *s)
+{
+	size_t mcus = s->mcu_count;
+	size_t blocks = mcus * (s->ycparts + 2);
+	
+	return(sizeof(uint32_t) * (mcus + 1) + /* pos */
+	       sizeof(int16_t) * 64 * blocks + /* coef */
+	       sizeof(uint16_t) * 2 * mcus +   /* bits and abits */
+	       blocks +                        /* ends */
+	       mcus * 2);                      /* tail and reset */
+}
+
+size_t ssdv_enc_plan_size(ssdv_t *s, uint8_t *jpeg, size_t length)
+{
+	uint8_t b;
+	
+	if(s->pkt_size_payload < PLAN_MIN_PAYLOAD) return(0);
+	
+	ssdv_enc_feed(s, jpeg, length);
+	
+	/* Read up to the start of the image data */
+	while(s->in_len && s->state != S_HUFF)
+	{
+		b = *(s->inp++);
+		s->in_len--;
+		
+		/* Skip bytes if necessary */
+		if(s->in_skip) { s->in_skip--; continue; }
+		
+		if(s->state == S_EOI || ssdv_marker_byte(s, b) != SSDV_OK) return(0);
+	}
+	
+	if(s->state != S_HUFF) return(0);
+	
+	return(ssdv_plan_bytes(s));
+}
+
+char ssdv_enc_plan(ssdv_t *s, ssdv_plan_t *p, uint8_t *buffer, size_t length)
+{
+	size_t mcus = s->mcu_count;
+	size_t yblocks = mcus * s->ycparts;
+	uint8_t b;
+	char r;
+	
+	if(s->state != S_HUFF || length < ssdv_plan_bytes(s)) return(SSDV_ERROR);
+	
+	p->pos     = (uint32_t *) buffer; buffer += sizeof(uint32_t) * (mcus + 1);
+	p->coef[0] = (int16_t *) buffer;  buffer += sizeof(int16_t) * 64 * yblocks;
+	p->coef[1] = (int16_t *) buffer;  buffer += sizeof(int16_t) * 64 * mcus;
+	p->coef[2] = (int16_t *) buffer;  buffer += sizeof(int16_t) * 64 * mcus;
+	p->bits    = (uint16_t *) buffer; buffer += sizeof(uint16_t) * mcus;
+	p->abits   = (uint16_t *) buffer; buffer += sizeof(uint16_t) * mcus;
+	p->ends[0] = buffer; buffer += yblocks;
+	p->ends[1] = buffer; buffer += mcus;
+	p->ends[2] = buffer; buffer += mcus;
+	p->tail    = buffer; buffer += mcus;
+	p->reset   = buffer;
+	
+	/* The MCUs of modes 1 and 3 are 8 pixels wide, 0 and 2 are 16 */
+	p->row_mcus = s->width >> (s->mcu_mode & 1 ? 3 : 4);
+	p->rows = (s->mcu_count + p->row_mcus - 1) / p->row_mcus;
+	p->length = 0;
+	p->packets = 0;
+	
+	while(s->in_len)
+	{
+		b = *(s->inp++);
+		s->in_len--;
+		
+		/* Skip bytes if necessary */
+		if(s->in_skip) { s->in_skip--; continue; }
+		
+		switch(s->state)
+		{
+		case S_MARKER:
+		case S_MARKER_LEN:
+		case S_MARKER_DATA:
+			r = ssdv_marker_byte(s, b);
+			if(r != SSDV_OK) return(r);
+			break;
+		
+		case S_HUFF:
+		case S_INT:
+			/* Is the next byte a stuffing byte? Skip it */
+			if(b == 0xFF) s->in_skip++;
+			
+			/* Add the new byte to the work area */
+			s->workbits = (s->workbits << 8) | b;
+			s->worklen += 8;
+			
+			/* Process the new data until more needed, or an error occurs */
+			while((r = ssdv_plan_process(s, p)) == SSDV_OK);
+			
+			if(r == SSDV_EOI)
+			{
+				s->state = S_EOI;
+				return(SSDV_OK);
+			}
+			else if(r != SSDV_FEED_ME)
+			{
+				fprintf(stderr, "ssdv_plan_process() failed: %i\n", r);
+				return(SSDV_ERROR);
+			}
+			break;
+		
+		case S_EOI:
+			break;
+		}
+	}
+	
+	fprintf(stderr, "Premature end of file\n");
+	return(SSDV_ERROR);
+}
+
+static void ssdv_plan_out_mcu(ssdv_t *s, ssdv_plan_t *p, uint16_t mcu)
+{
+	size_t block;
+	int16_t *coef;
+	uint8_t ends;
+	int part, k, run, adc;
+	
+	for(part = 0; part < s->ycparts + 2; part++)
+	{
+		s->component = (part < s->ycparts ? 0 : part - s->ycparts + 1);
+		block = ssdv_plan_block(s, mcu, part);
+		coef = &p->coef[s->component][block * 64];
+		ends = p->ends[s->component][block];
+		
+		/* DC, absolute for the first block of each component in a reset MCU */
+		adc = ssdv_plan_adc(s, p, &s->rq, s->component, block);
+		if(!p->reset[mcu] || (part > 0 && part < s->ycparts))
+		{
+			adc -= ssdv_plan_adc(s, p, &s->rq, s->component, block - 1);
+		}
+		
+		s->acpart = 0;
+		ssdv_out_jpeg_int(s, 0, adc);
+		
+		/* AC */
+		s->acpart = 1;
+		for(run = 0, k = 1; k < 64; k++)
+		{
+			if(coef[k] == 0) { run++; continue; }
+			
+			for(; run >= 16; run -= 16) ssdv_out_jpeg_int(s, 15, 0);
+			ssdv_out_jpeg_int(s, run, coef[k]);
+			run = 0;
+		}
+		
+		for(k = ends & PLAN_ZRL; k > 0; k--) ssdv_out_jpeg_int(s, 15, 0);
+		if(ends & PLAN_EOB) ssdv_out_jpeg_int(s, 0, 0);
+	}
+}
+
+char ssdv_enc_plan_packets(ssdv_t *s, ssdv_plan_t *p, int first, int count, uint8_t *packets)
+{
+	uint8_t buf[SSDV_PKT_SIZE_MAX + PLAN_MCU_MAX * 2], *out;
+	uint32_t pb = s->pkt_size_payload * 8;
+	uint32_t start, end, base;
+	uint16_t mcu_id, mcu_offset;
+	int lo, hi, m, h, k;
+	size_t d;
+	ssdv_t t;
+	
+	if(first < 0 || count < 0 || first + count > p->packets) return(SSDV_ERROR);
+	if(count == 0) return(SSDV_OK);
+	
+	/* Find the MCU the first packet begins in */
+	start = first * pb;
+	for(lo = 0, hi = s->mcu_count - 1; lo < hi;)
+	{
+		m = (lo + hi + 1) / 2;
+		if(p->pos[m] <= start) lo = m;
+		else hi = m - 1;
+	}
+	
+	/* Write from the start of that MCU into a copy of the encoder,
+	 * buf[0] holding byte 'base' of the packet data */
+	memcpy(&t, s, sizeof(ssdv_t));
+	t.out = t.outp = buf;
+	t.out_len = sizeof(buf);
+	t.out_stuff = 0;
+	t.outbits = 0;
+	t.outlen = 0;
+	
+	base = p->pos[lo] / 8;
+	ssdv_outbits(&t, 0, p->pos[lo] & 7);
+	
+	for(k = first, h = lo, m = lo; k < first + count; m++)
+	{
+		if(m < s->mcu_count)
+		{
+			ssdv_plan_out_mcu(&t, p, m);
+			
+			/* Align the next MCU */
+			if(m + 1 == s->mcu_count || p->reset[m + 1]) ssdv_outbits_sync(&t);
+			ssdv_outbits_flush(&t);
+		}
+		
+		/* Output each packet now complete */
+		for(; k < first + count; k++)
+		{
+			start = k * pb;
+			end = start + pb;
+			if(end > p->length) end = p->length;
+			if(m + 1 < s->mcu_count && base + (t.outp - buf) < end / 8) break;
+			
+			/* The first MCU to begin in this packet with absolute DC values */
+			mcu_id = 0xFFFF;
+			mcu_offset = 0xFFFF;
+			for(; h < s->mcu_count && p->pos[h] < end; h++)
+			{
+				if(p->reset[h] && p->pos[h] >= start)
+				{
+					mcu_id = h;
+					mcu_offset = p->pos[h] / 8 - start / 8;
+					break;
+				}
+			}
+			
+			out = &packets[s->pkt_size * (k - first)];
+			memset(out, 0, s->pkt_size);
+			memcpy(&out[s->pkt_size_header], &buf[start / 8 - base], (end - start) / 8);
+			ssdv_enc_finish_packet(s, out, k, k + 1 == p->packets, mcu_id, mcu_offset, (end - start) / 8);
+			
+			/* Drop the data before the next packet */
+			d = end / 8 - base;
+			memmove(buf, buf + d, (t.outp - buf) - d);
+			t.outp -= d;
+			t.out_len += d;
+			base += d;
+		}
+	}
+	
+	return(SSDV_OK);
+}
+
+/*****************************************************************************/
+
+static void ssdv_write_marker(ssdv_t *s, uint16_t id, uint16_t length, const uint8_t *data)
+{
+	ssdv_outbits(s, id, 16);
+	if(length > 0)
+	{
+		ssdv_outbits(s, length + 2, 16);
+		while(length--) ssdv_outbits(s, *(data++), 8);
+	}
+	
+	ssdv_outbits_flush(s);
+}
+
+static void ssdv_out_headers(ssdv_t *s)
+{
+	uint8_t *b = &s->stbls[s->stbl_len];
+	
+	ssdv_write_marker(s, J_SOI,    0, 0);
+	ssdv_write_marker(s, J_APP0,  14, app0);
+	ssdv_write_marker(s, J_DQT,   65, s->ddqt[0]);  /* DQT Luminance       */
+	ssdv_write_marker(s, J_DQT,   65, s->ddqt[1]);  /* DQT Chrominance     */
+	
+	/* Build SOF0 header */
+	b[0]  = 8; /* Precision */
+	b[1]  = s->height >> 8;
+	b[2]  = s->height & 0xFF;
+	b[3]  = s->width >> 8;
+	b[4]  = s->width & 0xFF;
+	b[5]  = 3; /* Components (Y'Cb'Cr) */
+	b[6]  = 1; /* Y */
+	switch(s->mcu_mode)
+	{
+	case 0: b[7] = 0x22; break;
+	case 1: b[7] = 0x12; break;
+	case 2: b[7] = 0x21; break;
+	case 3: b[7] = 0x11; break;
+	}
+	b[8]  = 0x00;
+	b[9]  = 2; /* Cb */
+	b[10] = 0x11;
+	b[11] = 0x01;
+	b[12] = 3; /* Cr */
+	b[13] = 0x11;
+	b[14] = 0x01;
+	ssdv_write_marker(s, J_SOF0,  15, b);  /* SOF0 (Baseline DCT) */
+	
+	ssdv_write_marker(s, J_DHT, jpeg_dht_length(s->ddht[0][0]), s->ddht[0][0]); /* DHT (DC Luminance)  */
+	ssdv_write_marker(s, J_DHT, jpeg_dht_length(s->ddht[1][0]), s->ddht[1][0]); /* DHT (AC Luminance)  */
+	ssdv_write_marker(s, J_DHT, jpeg_dht_length(s->ddht[0][1]), s->ddht[0][1]); /* DHT (DC Chrominance */
+	ssdv_write_marker(s, J_DHT, jpeg_dht_length(s->ddht[1][1]), s->ddht[1][1]); /* DHT (AC Chrominance */
+	ssdv_write_marker(s, J_SOS,   10, sos);
+}
+
+static void ssdv_empty_mcu(ssdv_t *s)
+{
+	const ssdv_hcode_t *dc, *ac;
+	int i, len = 0;
+	
+	/* Build the output bits for an MCU where every block has a
+	 * zero DC difference and an immediate EOB */
+	s->empty_mcu = 0;
+	s->empty_mcu_len = 0;
+	
+	for(i = 0; i < s->ycparts + 2; i++)
+	{
+		dc = s->dhcode[0][i < s->ycparts ? 0 : 1];
+		ac = s->dhcode[1][i < s->ycparts ? 0 : 1];
+		
+		len += dc->width[0x00] + ac->width[0x00];
+		if(dc->width[0x00] == 0 || ac->width[0x00] == 0 || len > 64) return;
+		
+		s->empty_mcu = (s->empty_mcu << dc->width[0x00]) | dc->code[0x00];
+		s->empty_mcu = (s->empty_mcu << ac->width[0x00]) | ac->code[0x00];
+	}
+	
+	s->empty_mcu_len = len;
+}
+
+static void ssdv_fill_gap(ssdv_t *s, uint16_t next_mcu)
+{
+	uint8_t len, n;
+	
+	if(s->mcupart > 0 || s->acpart > 0)
+	{
+		/* Cleanly end the current MCU part */
+		if(s->acpart > 0)
+		{
+			ssdv_out_jpeg_int(s, 0, 0);
+			s->mcupart++;
+		}
+		
+		/* End the current MCU block */
+		for(; s->mcupart < s->ycparts + 2; s->mcupart++)
+		{
+			if(s->mcupart < s->ycparts) s->component = 0;
+			else s->component = s->mcupart - s->ycparts + 1;
+			s->acpart = 0; ssdv_out_jpeg_int(s, 0, 0); /* DC */
+			s->acpart = 1; ssdv_out_jpeg_int(s, 0, 0); /* AC */
+		}
+		
+		s->mcu_id++;
+	}
+	
+	/* Pad out missing MCUs with the cached empty MCU */
+	for(; s->empty_mcu_len && s->mcu_id < next_mcu; s->mcu_id++)
+	{
+		for(len = s->empty_mcu_len; len; len -= n)
+		{
+			n = (len > 16 ? 16 : len);
+			ssdv_outbits(s, s->empty_mcu >> (len - n), n);
+		}
+	}
+	
+	/* Pad out missing MCUs */
+	for(; s->mcu_id < next_mcu; s->mcu_id++)
+	{
+		/* End the current MCU block */
+		for(s->mcupart = 0; s->mcupart < s->ycparts + 2; s->mcupart++)
 		{
 			if(s->mcupart < s->ycparts) s->component = 0;
 			else s->component = s->mcupart - s->ycparts + 1;
@@ -1221,331 +2800,1544 @@ static void ssdv_fill_gap(ssdv_t *s, uint16_t next_mcu)
 	}
 }
 
-char ssdv_dec_init(ssdv_t *s, int pkt_size)
+char ssdv_dec_init(ssdv_t *s, int pkt_size)
+{
+	/* Limit the packet length */
+	if(pkt_size > SSDV_PKT_SIZE_MAX || ssdv_pkt_size_payload(pkt_size, 0) < 2)
+	{
+		fprintf(stderr, "Invalid SSDV packet length\n");
+		return(SSDV_ERROR);
+	}
+	
+	pthread_once(&std_once, std_build);
+	
+	memset(s, 0, sizeof(ssdv_t));
+	s->pkt_size = pkt_size;
+	s->pkt_size_header = ssdv_pkt_size_header(pkt_size);
+	
+	/* The packet data should contain only scan data, no headers */
+	s->state = S_HUFF;
+	s->mode = S_DECODING;
+	
+	/* Prepare the source and output JPEG tables, the standard
+	 * ones unless the image comes with its own */
+	sload_dht(s, std_dht00, std_dht01, std_dht10, std_dht11);
+	dload_dht(s, std_dht00, std_dht01, std_dht10, std_dht11);
+	
+	return(SSDV_OK);
+}
+
+char ssdv_dec_set_buffer(ssdv_t *s, uint8_t *buffer, size_t length)
+{
+	size_t c = s->outp - s->out;
+	
+	s->outp = buffer + c;
+	s->out = buffer;
+	s->out_len = length - c;
+	
+	/* Flush the output bits */
+	ssdv_outbits_flush(s);
+	
+	return(SSDV_OK);
+}
+
+/* Read the tables received in table packets, checking they fit */
+static char ssdv_dec_read_tables(ssdv_t *s)
+{
+	uint8_t *b = s->ttbls, *end = &s->ttbls[s->ttbl_len];
+	uint16_t l;
+	int c, t;
+	
+	memset(s->tdht, 0, sizeof(s->tdht));
+	memset(s->tdqt, 0, sizeof(s->tdqt));
+	
+	while(b < end)
+	{
+		if(b[0] == (J_DQT & 0xFF))
+		{
+			/* 8-bit tables only, with no zero values */
+			if(end - b < 66 || b[1] > 1 || memchr(&b[2], 0, 64)) return(SSDV_ERROR);
+			
+			s->tdqt[b[1]] = &b[1];
+			b += 66;
+			continue;
+		}
+		
+		if(b[0] != (J_DHT & 0xFF) || end - b < 18) return(SSDV_ERROR);
+		
+		c = b[1] >> 4;
+		t = b[1] & 0x0F;
+		if(c > 1 || t > 1) return(SSDV_ERROR);
+		
+		/* No more symbols than the standard tables have room for */
+		l = jpeg_dht_length(&b[1]);
+		if(l > (c ? sizeof(std_dht10) : sizeof(std_dht00)) || end - b < 1 + l) return(SSDV_ERROR);
+		
+		/* A valid code of symbols the decoder can handle */
+		if(jpeg_dht_check(&b[1], 1) != SSDV_OK) return(SSDV_ERROR);
+		
+		s->tdht[c][t] = &b[1];
+		b += 1 + l;
+	}
+	
+	return(SSDV_OK);
+}
+
+static char ssdv_dec_feed_tables(ssdv_t *s, uint8_t *packet)
+{
+	uint32_t callsign = (packet[2] << 24) | (packet[3] << 16) | (packet[4] << 8) | packet[5];
+	uint16_t index = (packet[7] << 8) | packet[8];
+	uint8_t *d = &packet[s->pkt_size_header];
+	int length, offset, chunk, n;
+	
+	/* Already have them */
+	if(s->ttbl_len && s->ttbl_missing == 0) return(SSDV_FEED_ME);
+	
+	/* The tables follow their total length in each packet */
+	chunk = ssdv_pkt_size_payload(s->pkt_size, ssdv_rs_roots(packet[1])) - 2;
+	
+	length = (d[0] << 8) | d[1];
+	if(chunk < 1 || length == 0 || length > SSDV_TABLES_LEN) return(SSDV_FEED_ME);
+	
+	/* Start again if these are the tables of another image */
+	if(length != s->ttbl_len || callsign != s->ttbl_callsign || packet[6] != s->ttbl_image_id)
+	{
+		s->ttbl_len = length;
+		s->ttbl_missing = (length + chunk - 1) / chunk;
+		s->ttbl_callsign = callsign;
+		s->ttbl_image_id = packet[6];
+		memset(s->ttbl_have, 0, sizeof(s->ttbl_have));
+	}
+	
+	offset = index * chunk;
+	if(index >= (length + chunk - 1) / chunk || s->ttbl_have[index >> 3] & (1 << (index & 7)))
+	{
+		return(SSDV_FEED_ME);
+	}
+	
+	n = length - offset;
+	if(n > chunk) n = chunk;
+	memcpy(&s->ttbls[offset], &d[2], n);
+	s->ttbl_have[index >> 3] |= 1 << (index & 7);
+	s->ttbl_missing--;
+	
+	if(s->ttbl_missing == 0)
+	{
+		if(ssdv_dec_read_tables(s) == SSDV_OK)
+		{
+			fprintf(stderr, "Received the image tables\n");
+		}
+		else
+		{
+			fprintf(stderr, "Invalid image tables\n");
+			s->ttbl_len = 0;
+		}
+	}
+	
+	return(SSDV_FEED_ME);
+}
+
+/* Test if the tables the image in 'packet' needs are here */
+static char ssdv_dec_have_tables(ssdv_t *s, uint8_t *packet)
+{
+	uint32_t callsign = (packet[2] << 24) | (packet[3] << 16) | (packet[4] << 8) | packet[5];
+	uint8_t tables = packet[11] >> 6;
+	
+	if(tables == 0) return(SSDV_OK);
+	
+	/* Nowhere to build the code tables for the image's own */
+	if((tables & SSDV_TABLES_DHT) && !s->huff_tables) return(SSDV_ERROR);
+	
+	if(s->ttbl_len == 0 || s->ttbl_missing > 0 ||
+	   callsign != s->ttbl_callsign || packet[6] != s->ttbl_image_id)
+	{
+		return(SSDV_ERROR);
+	}
+	
+	if((tables & SSDV_TABLES_DHT) &&
+	   (!s->tdht[0][0] || !s->tdht[0][1] || !s->tdht[1][0] || !s->tdht[1][1]))
+	{
+		return(SSDV_ERROR);
+	}
+	
+	if((tables & SSDV_TABLES_DQT) && (!s->tdqt[0] || !s->tdqt[1]))
+	{
+		return(SSDV_ERROR);
+	}
+	
+	return(SSDV_OK);
+}
+
+static void ssdv_dec_start(ssdv_t *s, uint8_t *packet)
+{
+	const char *factor;
+	char callsign[SSDV_MAX_CALLSIGN + 1];
+	
+	/* Read the fixed headers from the packet */
+	s->type      = (packet[1] - 0x66) & SSDV_TYPE_NOFEC;
+	s->rs        = (packet[1] - 0x66) & SSDV_TYPE_RS;
+	s->callsign  = (packet[2] << 24) | (packet[3] << 16) | (packet[4] << 8) | packet[5];
+	s->image_id  = packet[6];
+	s->width     = packet[9] << 4;
+	s->height    = packet[10] << 4;
+	s->mcu_count = packet[9] * packet[10];
+	s->quality   = ((packet[11] >> 3) & 7) ^ 4;
+	s->mcu_mode  = packet[11] & 0x03;
+	s->tables    = packet[11] >> 6;
+	
+	/* Configure the payload size and CRC position */
+	ssdv_set_packet_conf(s);
+	
+	/* Use the image's own huffman tables */
+	if(s->tables & SSDV_TABLES_DHT)
+	{
+		sload_dht(s, s->tdht[0][0], s->tdht[0][1], s->tdht[1][0], s->tdht[1][1]);
+		dload_dht(s, s->tdht[0][0], s->tdht[0][1], s->tdht[1][0], s->tdht[1][1]);
+	}
+	
+	/* Generate the DQT tables */
+	if(s->tables & SSDV_TABLES_DQT)
+	{
+		/* Or the image's own */
+		s->sdqt[0] = stblcpy(s, s->tdqt[0], 65);
+		s->sdqt[1] = stblcpy(s, s->tdqt[1], 65);
+		s->ddqt[0] = dtblcpy(s, s->tdqt[0], 65);
+		s->ddqt[1] = dtblcpy(s, s->tdqt[1], 65);
+	}
+	else
+	{
+		s->sdqt[0] = sload_standard_dqt(s, std_dqt0, s->quality);
+		s->sdqt[1] = sload_standard_dqt(s, std_dqt1, s->quality);
+		s->ddqt[0] = dload_standard_dqt(s, std_dqt0, s->quality);
+		s->ddqt[1] = dload_standard_dqt(s, std_dqt1, s->quality);
+	}
+	ssdv_requant_init(&s->rq, s->sdqt, s->ddqt);
+	
+	switch(s->mcu_mode & 3)
+	{
+	case 0: factor = "2x2"; s->ycparts = 4; break;
+	case 1: factor = "1x2"; s->ycparts = 2; s->mcu_count *= 2; break;
+	case 2: factor = "2x1"; s->ycparts = 2; s->mcu_count *= 2; break;
+	case 3: factor = "1x1"; s->ycparts = 1; s->mcu_count *= 4; break;
+	}
+	
+	/* Display information about the image */
+	fprintf(stderr, "Callsign: %s\n", decode_callsign(callsign, s->callsign));
+	fprintf(stderr, "Image ID: %02X\n", s->image_id);
+	fprintf(stderr, "Resolution: %ix%i\n", s->width, s->height);
+	fprintf(stderr, "MCU blocks: %i\n", s->mcu_count);
+	fprintf(stderr, "Sampling factor: %s\n", factor);
+	fprintf(stderr, "Quality level: %d\n", s->quality);
+	
+	/* Output JPEG headers and enable byte stuffing */
+	ssdv_out_headers(s);
+	ssdv_empty_mcu(s);
+	s->out_stuff = 1;
+}
+
+static char ssdv_dec_feed_packet(ssdv_t *s, uint8_t *packet)
+{
+	int i = 0, r;
+	uint8_t b;
+	uint16_t packet_id;
+	
+	/* Read the packet header */
+	packet_id            = (packet[7] << 8) | packet[8];
+	s->packet_mcu_offset = ssdv_pkt_mcu_offset(packet, s->pkt_size);
+	s->packet_mcu_id     = (packet[13] << 8) | packet[14];
+	
+	if(s->packet_mcu_id != 0xFFFF)
+	{
+		/* Set the next reset MCU ID */
+		s->next_reset_mcu = s->packet_mcu_id;
+	}
+	
+	/* If this is the first packet, write the JPEG headers */
+	if(s->packet_id == 0)
+	{
+		/* Nothing can be decoded without the image's tables */
+		if(ssdv_dec_have_tables(s, packet) != SSDV_OK)
+		{
+			fprintf(stderr, "Dropped packet %d, the image tables have not been received\n", packet_id);
+			return(SSDV_FEED_ME);
+		}
+		
+		ssdv_dec_start(s, packet);
+	}
+	
+	/* The payload of a packet with other FEC won't be where we expect */
+	if(((packet[1] - 0x66) & (SSDV_TYPE_NOFEC | SSDV_TYPE_RS)) != (s->type | s->rs))
+	{
+		fprintf(stderr, "Dropped packet %d, its FEC differs from the image\n", packet_id);
+		return(SSDV_FEED_ME);
+	}
+	
+	/* Is this not the packet we expected? */
+	if(packet_id != s->packet_id)
+	{
+		if(packet_id < s->packet_id)
+		{
+			/* The decoder can only accept packets in the correct order */
+			fprintf(stderr, "Packets are not in order. %i > %i\n", s->packet_id - 1, packet_id);
+			return(SSDV_FEED_ME);
+		}
+		
+		/* One or more packets have been lost! */
+		fprintf(stderr, "Gap detected between packets %i and %i\n", s->packet_id - 1, packet_id);
+		
+		/* If this packet has no new MCU, ignore */
+		if(s->packet_mcu_id == 0xFFFF) return(SSDV_FEED_ME);
+		
+		/* Fill the gap left by the missing packet */
+		ssdv_fill_gap(s, s->packet_mcu_id);
+		
+		/* Skip the bytes of the lost MCU */
+		i = s->packet_mcu_offset;
+		
+		/* Reset the JPEG decoder state */
+		s->state = S_HUFF;
+		s->component = 0;
+		s->mcupart = 0;
+		s->acpart = 0;
+		s->accrle = 0;
+		
+		s->packet_id = packet_id;
+	}
+	
+	/* Feed the JPEG data into the processor */
+	for(; i < s->pkt_size_payload; i++)
+	{
+		if(i == s->packet_mcu_offset)
+		{
+			/* The first MCU in a packet is byte aligned,
+			 * any old bits should be dropped. */
+			s->workbits = s->worklen = 0;
+			
+			/* Abandon the packet if the MCU index is not what it should be. */
+			if(s->mcu_id != s->packet_mcu_id)
+			{
+				fprintf(stderr, "Unexpected MCU ID in packet %d.\n", packet_id);
+				return(SSDV_FEED_ME);
+			}
+		}
+		
+		b = packet[s->pkt_size_header + i];
+		
+		/* Add the new byte to the work area */
+		s->workbits = (s->workbits << 8) | b;
+		s->worklen += 8;
+		
+		/* Process the new data until more needed, or an error occurs */
+		while((r = ssdv_process(s)) == SSDV_OK);
+		
+		if(r == SSDV_BUFFER_FULL)
+		{
+			/* No space left and no sink to empty the buffer into */
+			fprintf(stderr, "Output buffer full\n");
+			return(SSDV_BUFFER_FULL);
+		}
+		else if(r == SSDV_EOI)
+		{
+			/* All done! */
+			return(SSDV_OK);
+		}
+		else if(r != SSDV_FEED_ME)
+		{
+			/* An error occured */
+			fprintf(stderr, "ssdv_process() failed: %i\n", r);
+			return(SSDV_ERROR);
+		}
+	}
+	
+	/* The next packet to expect... */
+	s->packet_id++;
+	
+	return(SSDV_FEED_ME);
+}
+
+static uint8_t *ssdv_dec_reorder_lowest(ssdv_t *s)
+{
+	uint8_t *p, *lowest = NULL;
+	int i;
+	
+	/* Find the earliest packet waiting in the reorder buffer */
+	for(i = 0; i < s->reorder_slots; i++)
+	{
+		p = &s->reorder[s->pkt_size * i];
+		if(p[0] != 0x55) continue;
+		
+		if(!lowest || ((p[7] << 8) | p[8]) < ((lowest[7] << 8) | lowest[8]))
+		{
+			lowest = p;
+		}
+	}
+	
+	return(lowest);
+}
+
+static char ssdv_dec_reorder_release(ssdv_t *s, uint8_t *slot, char r)
+{
+	char c;
+	
+	c = ssdv_dec_feed_packet(s, slot);
+	
+	/* Mark the slot as free */
+	slot[0] = 0x00;
+	
+	/* Pass on the end of the image or an error if either occur */
+	return(c == SSDV_FEED_ME ? r : c);
+}
+
+char ssdv_dec_set_huff_tables(ssdv_t *s, ssdv_huff_tables_t *tables)
+{
+	/* Used for the tables received in table packets */
+	s->huff_tables = tables;
+	
+	return(SSDV_OK);
+}
+
+char ssdv_dec_set_sink(ssdv_t *s, ssdv_sink_cb_t sink, void *user)
+{
+	s->sink = sink;
+	s->sink_user = user;
+	
+	return(SSDV_OK);
+}
+
+size_t ssdv_dec_max_jpeg_size(ssdv_t *s, uint8_t *packet)
+{
+	ssdv_packet_info_t info;
+	const ssdv_hcode_t *h;
+	size_t bits, blocks;
+	int i, c, w[2];
+	
+	ssdv_dec_header_n(&info, packet, s->pkt_size);
+	
+	/* The longest a block can be for each component: the longest DC
+	 * code and value, and 63 of the longest AC code and value. The
+	 * image's own tables may not be here yet, allow for 16 bit codes */
+	for(c = 0; c < 2 && info.tables; c++) w[c] = (16 + 11) + (16 + 10) * 63;
+	
+	for(c = 0; c < 2 && !info.tables; c++)
+	{
+		h = s->dhcode[0][c];
+		for(w[c] = i = 0; i < 12; i++)
+		{
+			if(h->width[i] && h->width[i] + i > w[c]) w[c] = h->width[i] + i;
+		}
+		
+		h = s->dhcode[1][c];
+		for(bits = i = 0; i < 256; i++)
+		{
+			if(h->width[i] && h->width[i] + (i & 0x0F) > bits) bits = h->width[i] + (i & 0x0F);
+		}
+		
+		w[c] += bits * 63;
+	}
+	
+	switch(info.mcu_mode)
+	{
+	case 0: blocks = 4; break;
+	case 1: case 2: blocks = 2; break;
+	default: blocks = 1; break;
+	}
+	
+	bits = info.mcu_count * (blocks * w[0] + 2 * w[1]);
+	
+	/* Every byte of the scan could need a stuffing byte, plus the
+	 * headers (SOI, APP0, DQT, SOF0, DHT, SOS) and EOI. No DHT
+	 * table is longer than the standard ones */
+	return((bits + 7) / 8 * 2 +
+	       2 + (4 + 14) + (4 + 65) * 2 + (4 + 15) + (4 + 29) * 2 + (4 + 179) * 2 + (4 + 10) + 2);
+}
+
+char ssdv_dec_set_reorder_buffer(ssdv_t *s, uint8_t *buffer, size_t length)
+{
+	int i;
+	
+	s->reorder = buffer;
+	s->reorder_slots = length / s->pkt_size;
+	
+	/* Mark every slot as free */
+	for(i = 0; i < s->reorder_slots; i++)
+	{
+		s->reorder[s->pkt_size * i] = 0x00;
+	}
+	
+	return(SSDV_OK);
+}
+
+char ssdv_dec_set_repair_buffer(ssdv_t *s, uint8_t *buffer, size_t length)
+{
+	int i, n = length / s->pkt_size;
+	
+	/* The repair packets of a group come first */
+	s->repair = buffer;
+	s->repair_slots = (n > SSDV_REPAIR_MAX ? n - SSDV_REPAIR_MAX : 0);
+	
+	/* Mark every slot as free */
+	for(i = 0; i < n; i++)
+	{
+		s->repair[s->pkt_size * i] = 0x00;
+	}
+	
+	return(SSDV_OK);
+}
+
+static char ssdv_dec_feed_repair(ssdv_t *s, uint8_t *packet)
+{
+	uint8_t cw[255], *slots = &s->repair[s->pkt_size * SSDV_REPAIR_MAX];
+	uint8_t *p, *group[255];
+	int eras[SSDV_REPAIR_MAX], lost[SSDV_REPAIR_MAX], er[SSDV_REPAIR_MAX];
+	int first, count, repairs, index, pad, missing, have, e, i, j, c, l;
+	char r = SSDV_FEED_ME, x;
+	
+	if(s->repair_slots == 0) return(SSDV_FEED_ME);
+	
+	first   = (packet[7] << 8) | packet[8];
+	count   = packet[9];
+	repairs = ssdv_rs_strengths[packet[10] >> 6];
+	index   = packet[10] & 0x3F;
+	
+	/* The whole group must fit in the buffer */
+	if(count < 1 || count > s->repair_slots || count + repairs > 255 || index >= repairs)
+	{
+		return(SSDV_FEED_ME);
+	}
+	
+	/* Start again if this is the first repair packet of another group */
+	for(have = j = 0; j < SSDV_REPAIR_MAX; j++)
+	{
+		p = &s->repair[s->pkt_size * j];
+		if(p[0] != 0x55) continue;
+		
+		if(memcmp(&p[1], &packet[1], 9) != 0 || (p[10] ^ packet[10]) & 0xC0)
+		{
+			for(i = 0; i < SSDV_REPAIR_MAX; i++) s->repair[s->pkt_size * i] = 0x00;
+			have = 0;
+			break;
+		}
+		
+		have++;
+	}
+	
+	p = &s->repair[s->pkt_size * index];
+	if(p[0] == 0x55) return(SSDV_FEED_ME);
+	memcpy(p, packet, s->pkt_size);
+	have++;
+	
+	/* Find the packets of the group that have been received. Lost packets
+	 * and repair packets are erasures in the RS codeword of each byte */
+	pad = 255 - count - repairs;
+	for(missing = e = i = 0; i < count; i++)
+	{
+		group[i] = &slots[s->pkt_size * ((first + i) % s->repair_slots)];
+		
+		if(group[i][0] != 0x55 || ((group[i][7] << 8) | group[i][8]) != first + i ||
+		   group[i][1] != packet[1] - SSDV_TYPE_REPAIR || memcmp(&group[i][2], &packet[2], 5) != 0)
+		{
+			if(missing == have) return(SSDV_FEED_ME);
+			lost[missing++] = i;
+			eras[e++] = pad + i;
+		}
+	}
+	
+	if(missing == 0) return(SSDV_FEED_ME);
+	
+	for(j = 0; j < repairs; j++)
+	{
+		group[count + j] = &s->repair[s->pkt_size * j];
+		if(group[count + j][0] != 0x55) eras[e++] = pad + count + j;
+	}
+	
+	/* The width and height aren't coded, take them from a packet of the
+	 * group that was received, or from the image */
+	for(p = NULL, i = j = 0; !p && i < count; i++)
+	{
+		if(j < missing && lost[j] == i) j++;
+		else p = group[i];
+	}
+	
+	if(!p && (s->packet_id == 0 || s->callsign != ((packet[2] << 24) | (packet[3] << 16) | (packet[4] << 8) | packet[5]) ||
+	          s->image_id != packet[6]))
+	{
+		return(SSDV_FEED_ME);
+	}
+	
+	/* Rebuild the header of each lost packet */
+	for(j = 0; j < missing; j++)
+	{
+		i = lost[j];
+		group[i][0] = 0x00;
+		group[i][1] = packet[1] - SSDV_TYPE_REPAIR;
+		memcpy(&group[i][2], &packet[2], 5);
+		group[i][7] = (first + i) >> 8;
+		group[i][8] = (first + i) & 0xFF;
+		group[i][9] = p ? p[9] : s->width >> 4;
+		group[i][10] = p ? p[10] : s->height >> 4;
+	}
+	
+	/* And the rest of it, a byte at a time */
+	l = s->pkt_size_header + ssdv_pkt_size_payload(s->pkt_size, ssdv_rs_roots(packet[1]));
+	for(c = 11; c < l; c++)
+	{
+		for(i = 0; i < count + repairs; i++) cw[i] = group[i][c];
+		
+		memcpy(er, eras, sizeof(int) * e);
+		if(decode_rs_8n(cw, er, e, pad, repairs) < 0)
+		{
+			fprintf(stderr, "Failed to repair packets %d to %d\n", first, first + count - 1);
+			return(SSDV_FEED_ME);
+		}
+		
+		for(j = 0; j < missing; j++) group[lost[j]][c] = cw[lost[j]];
+	}
+	
+	/* The group is done with, feed the repaired packets to the decoder.
+	 * They have no CRC or RS codes, but nothing checks them from here */
+	for(j = 0; j < SSDV_REPAIR_MAX; j++) s->repair[s->pkt_size * j] = 0x00;
+	
+	for(j = 0; j < missing; j++)
+	{
+		i = lost[j];
+		group[i][0] = 0x55;
+		
+		/* Too late if the decoder has moved on past it */
+		if(s->packet_id > first + i && s->image_id == packet[6] &&
+		   s->callsign == ((packet[2] << 24) | (packet[3] << 16) | (packet[4] << 8) | packet[5]))
+		{
+			continue;
+		}
+		
+		fprintf(stderr, "Repaired packet %d\n", first + i);
+		
+		x = ssdv_dec_feed(s, group[i]);
+		if(x != SSDV_FEED_ME) r = x;
+	}
+	
+	return(r);
+}
+
+char ssdv_dec_feed(ssdv_t *s, uint8_t *packet)
+{
+	uint8_t *slot;
+	int packet_id;
+	char r = SSDV_FEED_ME;
+	
+	/* Table packets are kept until the image is started */
+	if((packet[1] - 0x66) & SSDV_TYPE_TABLES) return(ssdv_dec_feed_tables(s, packet));
+	
+	if((packet[1] - 0x66) & SSDV_TYPE_REPAIR) return(ssdv_dec_feed_repair(s, packet));
+	
+	packet_id = (packet[7] << 8) | packet[8];
+	
+	/* Keep a copy for the repair packets of its group */
+	if(s->repair_slots > 0)
+	{
+		slot = &s->repair[s->pkt_size * (SSDV_REPAIR_MAX + packet_id % s->repair_slots)];
+		if(slot != packet) memcpy(slot, packet, s->pkt_size);
+	}
+	
+	if(s->reorder_slots == 0) return(ssdv_dec_feed_packet(s, packet));
+	
+	/* If the packet is too far ahead to hold, release the waiting
+	 * packets in order until it fits. Any gaps are filled as normal. */
+	while(packet_id >= s->packet_id + s->reorder_slots &&
+	      (slot = ssdv_dec_reorder_lowest(s)) != NULL)
+	{
+		r = ssdv_dec_reorder_release(s, slot, r);
+	}
+	
+	if(packet_id > s->packet_id && packet_id < s->packet_id + s->reorder_slots)
+	{
+		/* Early, hold onto it until the packets before it arrive */
+		slot = &s->reorder[s->pkt_size * (packet_id % s->reorder_slots)];
+		
+		/* A duplicate will already be in the slot */
+		if(slot[0] != 0x55) memcpy(slot, packet, s->pkt_size);
+	}
+	else
+	{
+		/* The expected packet, a late one or one we can't hold */
+		r = ssdv_dec_feed_packet(s, packet);
+	}
+	
+	/* Release any waiting packets that are now in order */
+	while(1)
+	{
+		slot = &s->reorder[s->pkt_size * (s->packet_id % s->reorder_slots)];
+		
+		if(slot[0] != 0x55 || ((slot[7] << 8) | slot[8]) != s->packet_id) break;
+		
+		r = ssdv_dec_reorder_release(s, slot, r);
+	}
+	
+	return(r);
+}
+
+char ssdv_dec_get_jpeg(ssdv_t *s, uint8_t **jpeg, size_t *length)
 {
-	/* Limit the packet length */
-	if(pkt_size > SSDV_PKT_SIZE)
+	uint8_t *slot;
+	
+	/* Release any packets still waiting to be reordered */
+	while(s->reorder_slots && (slot = ssdv_dec_reorder_lowest(s)) != NULL)
 	{
-		fprintf(stderr, "Invalid SSDV packet length\n");
-		return(SSDV_ERROR);
+		ssdv_dec_reorder_release(s, slot, SSDV_FEED_ME);
 	}
 	
-	memset(s, 0, sizeof(ssdv_t));
-	s->pkt_size = pkt_size;
+	/* Is the image complete? */
+	if(s->mcu_id < s->mcu_count) ssdv_fill_gap(s, s->mcu_count);
 	
-	/* The packet data should contain only scan data, no headers */
-	s->state = S_HUFF;
-	s->mode = S_DECODING;
+	/* Sync, and final EOI header and return */
+	ssdv_outbits_sync(s);
+	s->out_stuff = 0;
+	ssdv_write_marker(s, J_EOI, 0, 0);
 	
-	/* Prepare the source JPEG tables */
-	s->sdht[0][0] = stblcpy(s, std_dht00, sizeof(std_dht00));
-	s->sdht[0][1] = stblcpy(s, std_dht01, sizeof(std_dht01));
-	s->sdht[1][0] = stblcpy(s, std_dht10, sizeof(std_dht10));
-	s->sdht[1][1] = stblcpy(s, std_dht11, sizeof(std_dht11));
+	/* Anything left in the buffer goes to the sink, if there is one */
+	ssdv_out_drain(s);
 	
-	/* Prepare the output JPEG tables */
-	s->ddht[0][0] = dtblcpy(s, std_dht00, sizeof(std_dht00));
-	s->ddht[0][1] = dtblcpy(s, std_dht01, sizeof(std_dht01));
-	s->ddht[1][0] = dtblcpy(s, std_dht10, sizeof(std_dht10));
-	s->ddht[1][1] = dtblcpy(s, std_dht11, sizeof(std_dht11));
+	*jpeg = s->out;
+	*length = (size_t) (s->outp - s->out);
 	
 	return(SSDV_OK);
 }
 
-char ssdv_dec_set_buffer(ssdv_t *s, uint8_t *buffer, size_t length)
+char ssdv_dec_snapshot(ssdv_t *s, uint8_t **jpeg, size_t *length)
 {
-	size_t c = s->outp - s->out;
+	uint8_t *outp, outlen, out_stuff, mcupart, component, acpart;
+	uint64_t outbits;
+	uint16_t mcu_id;
+	size_t out_len;
+	char r = SSDV_OK;
 	
-	s->outp = buffer + c;
-	s->out = buffer;
-	s->out_len = length - c;
+	/* Nothing to show before the first packet, and
+	 * the start of the image is gone if a sink is used */
+	if(s->packet_id == 0 || s->sink) return(SSDV_ERROR);
+	
+	/* Save the output state */
+	outp      = s->outp;
+	out_len   = s->out_len;
+	outbits   = s->outbits;
+	outlen    = s->outlen;
+	out_stuff = s->out_stuff;
+	mcu_id    = s->mcu_id;
+	mcupart   = s->mcupart;
+	component = s->component;
+	acpart    = s->acpart;
+	
+	/* Pad out the rest of the image into the free space after the
+	 * data decoded so far. This is overwritten by the next packet. */
+	if(s->mcu_id < s->mcu_count) ssdv_fill_gap(s, s->mcu_count);
+	ssdv_outbits_sync(s);
+	s->out_stuff = 0;
+	ssdv_write_marker(s, J_EOI, 0, 0);
+	
+	if(s->outlen > 0) r = SSDV_BUFFER_FULL;
+	
+	*jpeg = s->out;
+	*length = (size_t) (s->outp - s->out);
+	
+	/* Restore the output state */
+	s->outp      = outp;
+	s->out_len   = out_len;
+	s->outbits   = outbits;
+	s->outlen    = outlen;
+	s->out_stuff = out_stuff;
+	s->mcu_id    = mcu_id;
+	s->mcupart   = mcupart;
+	s->component = component;
+	s->acpart    = acpart;
+	
+	return(r);
+}
+
+static char ssdv_dec_check_header(uint8_t *packet, int pkt_size, uint8_t type, int pkt_size_payload)
+{
+	ssdv_packet_info_t p;
+	
+	ssdv_dec_header_n(&p, packet, pkt_size);
+	
+	if(p.type != type) return(-1);
+	
+	/* A repair packet has codes in place of the rest of the header,
+	 * byte 9 is the number of packets it repairs */
+	if(type & SSDV_TYPE_REPAIR)
+	{
+		if(packet[9] == 0) return(-1);
+	}
+	else
+	{
+		if(p.width == 0 || p.height == 0) return(-1);
+		if(p.mcu_id != 0xFFFF)
+		{
+			if(p.mcu_id >= p.mcu_count) return(-1);
+			if(p.mcu_offset >= pkt_size_payload) return(-1);
+		}
+	}
+	
+	return(0);
+}
+
+char ssdv_dec_is_packet(uint8_t *packet, int pkt_size, int *errors)
+{
+	return(ssdv_dec_is_packet_soft(packet, pkt_size, NULL, errors));
+}
+
+char ssdv_dec_is_packet_soft(uint8_t *packet, int pkt_size, uint8_t *confidence, int *errors)
+{
+	uint8_t pkt[SSDV_PKT_SIZE_MAX];
+	uint8_t type;
+	uint16_t pkt_size_payload;
+	uint16_t pkt_size_crcdata;
+	uint32_t x;
+	int i, n, k, roots, rs, first, last;
+	
+	if(pkt_size > SSDV_PKT_SIZE_MAX) return(-1);
+	
+	/* Testing is destructive, work on a copy */
+	memcpy(pkt, packet, pkt_size);
+	pkt[0] = 0x55;
+	
+	type = SSDV_TYPE_INVALID;
+	roots = ssdv_rs_roots(pkt[1]);
+	
+	if(roots >= 0 && ssdv_pkt_size_payload(pkt_size, roots) >= 2)
+	{
+		/* Test for a valid NOFEC or NORMAL packet */
+		pkt_size_payload = ssdv_pkt_size_payload(pkt_size, roots);
+		pkt_size_crcdata = ssdv_pkt_size_header(pkt_size) + pkt_size_payload - 1;
+		
+		/* No FEC scan */
+		if(errors) *errors = 0;
+		
+		/* Test the checksum */
+		x = ssdv_crc32(&pkt[1], pkt_size_crcdata);
+		
+		i = 1 + pkt_size_crcdata;
+		if(x == (pkt[i + 3] | (pkt[i + 2] << 8) | (pkt[i + 1] << 16) | (pkt[i] << 24)))
+		{
+			/* Valid, set the type and continue */
+			type = pkt[1] - 0x66;
+		}
+	}
+	
+	/* Test for a valid NORMAL packet with correctable errors. Try the
+	 * strength the type byte gives first, or the default. A candidate with
+	 * a damaged sync byte must have an intact type byte, so only that is
+	 * tried, otherwise the type may be damaged and every strength is. A
+	 * damaged type byte is most likely an image packet, the decoder
+	 * corrects it if it is a table packet */
+	first = roots > 0 ? ((pkt[1] - 0x66) & SSDV_TYPE_RS) >> 2 : 0;
+	last = roots >= 0 && packet[0] != 0x55 ? 0 : 3;
+	
+	for(n = 0; type == SSDV_TYPE_INVALID && n <= last; n++)
+	{
+		rs = n == 0 ? first : (n <= first ? n - 1 : n);
+		
+		if(ssdv_pkt_size_payload(pkt_size, ssdv_rs_strengths[rs]) < 2) continue;
+		
+		pkt_size_payload = ssdv_pkt_size_payload(pkt_size, ssdv_rs_strengths[rs]);
+		pkt_size_crcdata = ssdv_pkt_size_header(pkt_size) + pkt_size_payload - 1;
+		
+		/* With the confidence of each byte, try again erasing more of
+		 * the least confident bytes, a quarter of the codes at a time */
+		for(k = 0; type == SSDV_TYPE_INVALID && k <= (confidence ? 4 : 0); k++)
+		{
+			/* Start each attempt from the packet as received */
+			memcpy(pkt, packet, pkt_size);
+			pkt[0] = 0x55;
+			if(n > 0 || roots <= 0) pkt[1] = 0x66 + (rs << 2);
+			
+			/* Run the reed-solomon decoder */
+			i = ssdv_rs_decode(pkt, pkt_size, ssdv_rs_strengths[rs], confidence, ssdv_rs_strengths[rs] * k / 4);
+			
+			if(i < 0) continue; /* Reed-solomon decoder failed */
+			if(errors) *errors = i;
+			
+			/* Test the checksum */
+			x = ssdv_crc32(&pkt[1], pkt_size_crcdata);
+			
+			i = 1 + pkt_size_crcdata;
+			if(x == (pkt[i + 3] | (pkt[i + 2] << 8) | (pkt[i + 1] << 16) | (pkt[i] << 24)) &&
+			   ssdv_rs_roots(pkt[1]) == ssdv_rs_strengths[rs])
+			{
+				/* Valid, set the type and continue */
+				type = pkt[1] - 0x66;
+			}
+		}
+	}
+	
+	if(type == SSDV_TYPE_INVALID)
+	{
+		/* All attempts to read the packet have failed */
+		return(-1);
+	}
+	
+	/* Sanity checks */
+	if(ssdv_dec_check_header(pkt, pkt_size, type, pkt_size_payload) != 0) return(-1);
+	
+	/* Appears to be a valid packet! Copy it back */
+	memcpy(packet, pkt, pkt_size);
+	
+	return(0);
+}
+
+char ssdv_dec_is_candidate(uint8_t *packet)
+{
+	/* Either the sync or type byte must be intact. Requiring both, or a
+	 * plausible header as well, rejects too many correctable packets */
+	if(packet[0] == 0x55) return(0);
+	if(ssdv_rs_roots(packet[1]) >= 0) return(0);
+	
+	return(-1);
+}
+
+int ssdv_dec_repair_group(uint8_t *packet, int *repairs)
+{
+	if(!((packet[1] - 0x66) & SSDV_TYPE_REPAIR)) return(0);
+	
+	/* Byte 9 is the number of packets in the group, the top two
+	 * bits of byte 10 the strength of the code across it */
+	if(repairs) *repairs = ssdv_rs_strengths[packet[10] >> 6];
+	
+	return(packet[9]);
+}
+
+char ssdv_dec_find_packet(uint8_t *buffer, size_t length, int pkt_size, size_t *offset, int *errors)
+{
+	return(ssdv_dec_find_packet_soft(buffer, NULL, length, pkt_size, offset, errors));
+}
+
+char ssdv_dec_find_packet_soft(uint8_t *buffer, uint8_t *confidence, size_t length, int pkt_size, size_t *offset, int *errors)
+{
+	size_t i;
+	
+	if(length < (size_t) pkt_size)
+	{
+		*offset = 0;
+		return(-1);
+	}
+	
+	for(i = 0; i <= length - pkt_size; i++)
+	{
+		/* The first position is where the next packet of an aligned
+		 * stream would be, so always try it. Elsewhere only test
+		 * positions that look like the start of a packet */
+		if(i > 0 && ssdv_dec_is_candidate(&buffer[i]) != 0) continue;
+		
+		if(ssdv_dec_is_packet_soft(&buffer[i], pkt_size, confidence ? &confidence[i] : NULL, errors) == 0)
+		{
+			*offset = i;
+			return(0);
+		}
+	}
+	
+	/* Nothing found, everything before this point can be discarded */
+	*offset = i;
+	
+	return(-1);
+}
+
+int ssdv_dec_is_packets(uint8_t *packets, int count, int pkt_size, int *errors)
+{
+	const uint8_t *d[SSDV_VALIDATE_PACKETS];
+	uint32_t crc[SSDV_VALIDATE_PACKETS], x;
+	int payload[SSDV_VALIDATE_PACKETS], length;
+	uint8_t *p;
+	int i, j, k, n, roots;
+	
+	for(i = 0; i < count; i += n)
+	{
+		n = count - i;
+		if(n > SSDV_VALIDATE_PACKETS) n = SSDV_VALIDATE_PACKETS;
+		
+		/* The payload size of each packet by its type */
+		for(j = 0; j < n; j++)
+		{
+			p = &packets[pkt_size * (i + j)];
+			roots = ssdv_rs_roots(p[1]);
+			
+			payload[j] = (roots >= 0 ? ssdv_pkt_size_payload(pkt_size, roots) : 0);
+			d[j] = &p[1];
+		}
+		
+		/* Work out the CRCs of each run of packets of the same type
+		 * together, usually all of them */
+		for(j = 0; j < n; j += k)
+		{
+			for(k = 1; j + k < n && payload[j + k] == payload[j]; k++);
+			
+			length = ssdv_pkt_size_header(pkt_size) + payload[j] - 1;
+			if(payload[j] >= 2) ssdv_crc32_n(&d[j], length, k, &crc[j]);
+		}
+		
+		for(j = 0; j < n; j++)
+		{
+			p = &packets[pkt_size * (i + j)];
+			length = ssdv_pkt_size_header(pkt_size) + payload[j] - 1;
+			
+			/* A packet with a good CRC is valid as it is, without
+			 * copying it. Any others are tested as normal */
+			x = ((uint32_t) p[length + 1] << 24) | (p[length + 2] << 16) | (p[length + 3] << 8) | p[length + 4];
+			
+			if(payload[j] >= 2 && crc[j] == x &&
+			   ssdv_dec_check_header(p, pkt_size, p[1] - 0x66, payload[j]) == 0)
+			{
+				p[0] = 0x55;
+				if(errors) errors[i + j] = 0;
+			}
+			else if(ssdv_dec_is_packet(p, pkt_size, errors ? &errors[i + j] : NULL) != 0)
+			{
+				/* The packets after this one are likely misaligned */
+				return(i + j);
+			}
+		}
+	}
+	
+	return(count);
+}
+
+void ssdv_dec_header_n(ssdv_packet_info_t *info, uint8_t *packet, int pkt_size)
+{
+	info->type       = packet[1] - 0x66;
+	info->callsign   = (packet[2] << 24) | (packet[3] << 16) | (packet[4] << 8) | packet[5];
+	decode_callsign(info->callsign_s, info->callsign);
+	info->image_id   = packet[6];
+	info->packet_id  = (packet[7] << 8) | packet[8];
+	info->width      = packet[9] << 4;
+	info->height     = packet[10] << 4;
+	info->eoi        = (packet[11] >> 2) & 1;
+	info->quality    = ((packet[11] >> 3) & 7) ^ 4;
+	info->tables     = packet[11] >> 6;
+	info->mcu_mode   = packet[11] & 0x03;
+	info->mcu_offset = ssdv_pkt_mcu_offset(packet, pkt_size);
+	info->mcu_id     = (packet[13] << 8) | packet[14];
+	info->mcu_count  = packet[9] * packet[10];
+	if(info->mcu_mode == 1 || info->mcu_mode == 2) info->mcu_count *= 2;
+	else if(info->mcu_mode == 3) info->mcu_count *= 4;
+}
+
+void ssdv_dec_header(ssdv_packet_info_t *info, uint8_t *packet)
+{
+	ssdv_dec_header_n(info, packet, SSDV_PKT_SIZE);
+}
+
+/*****************************************************************************/
+
+/* Packet ID and MCU ID from a packet header */
+#define PKT_ID(p) (((p)[7] << 8) | (p)[8])
+#define PKT_MCU_ID(p) (((p)[13] << 8) | (p)[14])
+
+static void ssdv_dec_segment_reset(ssdv_t *s, ssdv_segment_t *seg)
+{
+	/* The first MCU of a segment has absolute DC values */
+	s->state = S_HUFF;
+	s->mcu_id = seg->mcu_id;
+	s->reset_mcu = s->next_reset_mcu = seg->mcu_id;
+	s->component = 0;
+	s->mcupart = 0;
+	s->acpart = 0;
+	s->accrle = 0;
+	s->workbits = s->worklen = 0;
+}
+
+static char ssdv_dec_segment_run(ssdv_t *s, ssdv_segment_t *seg, int *k, int *i, uint16_t stop)
+{
+	uint8_t *packet, mcupart, acpart;
+	size_t pos;
+	char r;
+	
+	/* Decode the segment data from packet k, byte i, until the MCU 'stop' */
+	while(1)
+	{
+		/* Process the bits already in the work area */
+		while(s->mcu_id != stop)
+		{
+			mcupart = s->mcupart;
+			acpart = s->acpart;
+			pos = (s->outp - s->out) * 8 + s->outlen;
+			
+			if((r = ssdv_process(s)) != SSDV_OK) break;
+			
+			/* Note where each absolute DC value in the first MCU is
+			 * written, they are replaced when the segment is stitched */
+			if(seg->seams < 3 && s->mcu_id == seg->mcu_id &&
+			   acpart == 0 && s->acpart > 0 &&
+			   (mcupart == 0 || mcupart >= s->ycparts))
+			{
+				seg->dc_pos[seg->seams] = pos;
+				seg->dc_len[seg->seams] = (s->outp - s->out) * 8 + s->outlen - pos;
+				seg->dc_value[seg->seams] = s->dc[seg->seams];
+				seg->seams++;
+			}
+		}
+		
+		if(s->mcu_id == stop) return(SSDV_OK);
+		if(r != SSDV_FEED_ME) return(r);
+		
+		/* Move on to the next packet when this one is used up */
+		while(*k < seg->count && *i >= (*k == seg->count - 1 ? seg->end : s->pkt_size_payload))
+		{
+			(*k)++;
+			*i = 0;
+		}
+		
+		/* Ran out of data? */
+		if(*k == seg->count) return(SSDV_FEED_ME);
+		
+		packet = &seg->packets[s->pkt_size * *k];
+		
+		/* Add the next byte to the work area */
+		s->workbits = (s->workbits << 8) | packet[s->pkt_size_header + (*i)++];
+		s->worklen += 8;
+	}
+}
+
+static void ssdv_outbits_copy(ssdv_t *s, uint8_t *data, size_t start, size_t end)
+{
+	uint32_t w;
+	uint8_t n;
+	
+	/* Copy bits start to end-1 to the output, 16 at a time */
+	for(; end - start >= 24; start += 16)
+	{
+		w = (data[start >> 3] << 16) | (data[(start >> 3) + 1] << 8) | data[(start >> 3) + 2];
+		ssdv_outbits(s, w >> (8 - (start & 7)), 16);
+	}
+	
+	/* Then the rest a byte at a time */
+	for(; start < end; start += n)
+	{
+		n = 8 - (start & 7);
+		if(n > end - start) n = end - start;
+		
+		ssdv_outbits(s, data[start >> 3] >> (8 - (start & 7) - n), n);
+	}
+}
+
+char ssdv_dec_split(ssdv_t *s, uint8_t *packets, int count, ssdv_segment_t *segments, int *nsegments, uint8_t *buffer, size_t length)
+{
+	ssdv_segment_t *seg;
+	uint8_t *p;
+	size_t size;
+	int j, k;
+	
+	*nsegments = 0;
+	if(count == 0) return(SSDV_OK);
+	
+	/* The packets must be for one image and in order */
+	for(j = 1; j < count; j++)
+	{
+		if(PKT_ID(&packets[s->pkt_size * j]) <= PKT_ID(&packets[s->pkt_size * (j - 1)]))
+		{
+			return(SSDV_ERROR);
+		}
+	}
+	
+	/* Write the JPEG headers */
+	if(s->packet_id == 0)
+	{
+		if(ssdv_dec_have_tables(s, packets) != SSDV_OK) return(SSDV_ERROR);
+		ssdv_dec_start(s, packets);
+	}
+	
+	for(j = 0; j < count; j = k)
+	{
+		p = &packets[s->pkt_size * j];
+		
+		/* Follow on the packets with no new MCU, these
+		 * can't be used without the packet before them */
+		for(k = j + 1; k < count; k++)
+		{
+			if(PKT_ID(&packets[s->pkt_size * k]) != PKT_ID(&packets[s->pkt_size * (k - 1)]) + 1) break;
+			if(PKT_MCU_ID(&packets[s->pkt_size * k]) != 0xFFFF) break;
+		}
+		
+		if(PKT_MCU_ID(p) == 0xFFFF || PKT_MCU_ID(p) >= s->mcu_count) continue;
+		if(ssdv_pkt_mcu_offset(p, s->pkt_size) >= s->pkt_size_payload) continue;
+		
+		seg = &segments[(*nsegments)++];
+		seg->packets = p;
+		seg->count = k - j;
+		seg->offset = ssdv_pkt_mcu_offset(p, s->pkt_size);
+		seg->end = s->pkt_size_payload;
+		seg->mcu_id = PKT_MCU_ID(p);
+		seg->mcu_end = s->mcu_count;
+		seg->status = SSDV_ERROR;
+		
+		/* If the next packet follows on, the segment ends at its first MCU */
+		if(k < count && PKT_ID(&packets[s->pkt_size * k]) == PKT_ID(&packets[s->pkt_size * (k - 1)]) + 1)
+		{
+			p = &packets[s->pkt_size * k];
+			
+			if(ssdv_pkt_mcu_offset(p, s->pkt_size) < s->pkt_size_payload && PKT_MCU_ID(p) > seg->mcu_id)
+			{
+				seg->count++;
+				seg->end = ssdv_pkt_mcu_offset(p, s->pkt_size);
+				seg->mcu_end = PKT_MCU_ID(p);
+			}
+		}
+		
+		/* Give it room for twice the input data. If the buffer runs
+		 * out the segment is decoded sequentially when stitched. */
+		size = (s->pkt_size_payload * (seg->count - 1) + seg->end - seg->offset) * 2 + 8;
+		if(size > length) size = 0;
+		
+		seg->out = buffer;
+		seg->out_length = size;
+		buffer += size;
+		length -= size;
+	}
 	
-	/* Flush the output bits */
-	ssdv_outbits(s, 0, 0);
+	/* The next packet to expect... */
+	s->packet_id = PKT_ID(&packets[s->pkt_size * (count - 1)]) + 1;
 	
 	return(SSDV_OK);
 }
 
-char ssdv_dec_feed(ssdv_t *s, uint8_t *packet)
+char ssdv_dec_segment(ssdv_t *s, ssdv_segment_t *seg)
 {
-	int i = 0, r;
-	uint8_t b;
-	uint16_t packet_id;
+	ssdv_t t;
+	int k = 0, i = seg->offset;
+	char r;
 	
-	/* Read the packet header */
-	packet_id            = (packet[7] << 8) | packet[8];
-	s->packet_mcu_offset = packet[12];
-	s->packet_mcu_id     = (packet[13] << 8) | packet[14];
+	seg->seams = 0;
 	
-	if(s->packet_mcu_id != 0xFFFF)
+	if(seg->out_length == 0)
 	{
-		/* Set the next reset MCU ID */
-		s->next_reset_mcu = s->packet_mcu_id;
+		seg->status = SSDV_BUFFER_FULL;
+		return(seg->status);
 	}
 	
-	/* If this is the first packet, write the JPEG headers */
-	if(s->packet_id == 0)
+	/* Work on a copy of the decoder so segments can be decoded at
+	 * the same time. The DC values start from zero, so the first
+	 * DC code of each component holds its absolute value. */
+	memcpy(&t, s, sizeof(ssdv_t));
+	ssdv_dec_segment_reset(&t, seg);
+	t.dc[0] = t.dc[1] = t.dc[2] = 0;
+	
+	t.out = t.outp = seg->out;
+	t.out_len = seg->out_length;
+	t.outbits = 0;
+	t.outlen = 0;
+	t.out_stuff = 0;
+	t.sink = NULL;
+	
+	/* Don't end the image here, it's done when stitched */
+	t.mcu_count = 0xFFFF;
+	
+	r = ssdv_dec_segment_run(&t, seg, &k, &i, seg->mcu_end);
+	
+	/* If the data ran out, end the current MCU cleanly */
+	if(r == SSDV_FEED_ME)
 	{
-		const char *factor;
-		char callsign[SSDV_MAX_CALLSIGN + 1];
-		
-		/* Read the fixed headers from the packet */
-		s->type      = packet[1] - 0x66;
-		s->callsign  = (packet[2] << 24) | (packet[3] << 16) | (packet[4] << 8) | packet[5];
-		s->image_id  = packet[6];
-		s->width     = packet[9] << 4;
-		s->height    = packet[10] << 4;
-		s->mcu_count = packet[9] * packet[10];
-		s->quality   = ((packet[11] >> 3) & 7) ^ 4;
-		s->mcu_mode  = packet[11] & 0x03;
+		ssdv_fill_gap(&t, t.mcu_id);
+		r = SSDV_OK;
+	}
+	
+	seg->bits = (t.outp - t.out) * 8 + t.outlen;
+	seg->mcu_next = t.mcu_id;
+	seg->dc[0] = t.dc[0];
+	seg->dc[1] = t.dc[1];
+	seg->dc[2] = t.dc[2];
+	
+	/* Write out the last bits */
+	if(t.outlen % 8) ssdv_outbits(&t, 0, 8 - t.outlen % 8);
+	ssdv_outbits_flush(&t);
+	if(t.outlen > 0) r = SSDV_BUFFER_FULL;
+	
+	seg->status = r;
+	
+	return(r);
+}
+
+char ssdv_dec_stitch(ssdv_t *s, ssdv_segment_t *segments, int nsegments)
+{
+	ssdv_segment_t *seg;
+	size_t pos;
+	int j, k, i, c;
+	char r;
+	
+	for(j = 0; j < nsegments; j++)
+	{
+		seg = &segments[j];
 		
-		/* Configure the payload size and CRC position */
-		ssdv_set_packet_conf(s);
+		/* Overlaps the last segment? */
+		if(seg->mcu_id < s->mcu_id) continue;
 		
-		/* Generate the DQT tables */
-		s->sdqt[0] = sload_standard_dqt(s, std_dqt0, s->quality);
-		s->sdqt[1] = sload_standard_dqt(s, std_dqt1, s->quality);
-		s->ddqt[0] = dload_standard_dqt(s, std_dqt0, s->quality);
-		s->ddqt[1] = dload_standard_dqt(s, std_dqt1, s->quality);
+		/* Fill the gap left by any missing packets */
+		if(seg->mcu_id > s->mcu_id) ssdv_fill_gap(s, seg->mcu_id);
 		
-		switch(s->mcu_mode & 3)
+		if(seg->status == SSDV_OK)
 		{
-		case 0: factor = "2x2"; s->ycparts = 4; break;
-		case 1: factor = "1x2"; s->ycparts = 2; s->mcu_count *= 2; break;
-		case 2: factor = "2x1"; s->ycparts = 2; s->mcu_count *= 2; break;
-		case 3: factor = "1x1"; s->ycparts = 1; s->mcu_count *= 4; break;
+			/* Copy the segment, replacing the absolute DC
+			 * values with the difference from the last */
+			for(pos = c = 0; c < seg->seams; c++)
+			{
+				ssdv_outbits_copy(s, seg->out, pos, seg->dc_pos[c]);
+				pos = seg->dc_pos[c] + seg->dc_len[c];
+				
+				s->component = c;
+				s->acpart = 0;
+				ssdv_out_jpeg_int(s, 0, seg->dc_value[c] - s->dc[c]);
+			}
+			
+			ssdv_outbits_copy(s, seg->out, pos, seg->bits);
+			
+			/* The DC values are only known for the components seen */
+			for(c = 0; c < seg->seams; c++) s->dc[c] = seg->dc[c];
+			s->mcu_id = seg->mcu_next;
 		}
-		
-		/* Display information about the image */
-		fprintf(stderr, "Callsign: %s\n", decode_callsign(callsign, s->callsign));
-		fprintf(stderr, "Image ID: %02X\n", s->image_id);
-		fprintf(stderr, "Resolution: %ix%i\n", s->width, s->height);
-		fprintf(stderr, "MCU blocks: %i\n", s->mcu_count);
-		fprintf(stderr, "Sampling factor: %s\n", factor);
-		fprintf(stderr, "Quality level: %d\n", s->quality);
-		
-		/* Output JPEG headers and enable byte stuffing */
-		ssdv_out_headers(s);
-		s->out_stuff = 1;
-	}
-	
-	/* Is this not the packet we expected? */
-	if(packet_id != s->packet_id)
-	{
-		if(packet_id < s->packet_id)
+		else
 		{
-			/* The decoder can only accept packets in the correct order */
-			fprintf(stderr, "Packets are not in order. %i > %i\n", s->packet_id - 1, packet_id);
-			return(SSDV_FEED_ME);
+			/* Not decoded in parallel, do it now */
+			ssdv_dec_segment_reset(s, seg);
+			k = 0;
+			i = seg->offset;
+			
+			r = ssdv_dec_segment_run(s, seg, &k, &i, seg->mcu_end);
+			
+			/* If the data ran out, end the current MCU cleanly */
+			if(r == SSDV_FEED_ME) ssdv_fill_gap(s, s->mcu_id);
 		}
 		
-		/* One or more packets have been lost! */
-		fprintf(stderr, "Gap detected between packets %i and %i\n", s->packet_id - 1, packet_id);
-		
-		/* If this packet has no new MCU, ignore */
-		if(s->packet_mcu_id == 0xFFFF) return(SSDV_FEED_ME);
-		
-		/* Fill the gap left by the missing packet */
-		ssdv_fill_gap(s, s->packet_mcu_id);
-		
-		/* Skip the bytes of the lost MCU */
-		i = s->packet_mcu_offset;
-		
-		/* Reset the JPEG decoder state */
-		s->state = S_HUFF;
-		s->component = 0;
 		s->mcupart = 0;
 		s->acpart = 0;
-		s->accrle = 0;
-		
-		s->packet_id = packet_id;
 	}
 	
-	/* Feed the JPEG data into the processor */
-	for(; i < s->pkt_size_payload; i++)
+	s->state = S_HUFF;
+	s->component = 0;
+	
+	return(SSDV_OK);
+}
+
+/*****************************************************************************/
+
+static void ssdv_demux_output(ssdv_demux_t *d, ssdv_session_t *ss)
+{
+	uint8_t *jpeg;
+	size_t length;
+	char complete;
+	
+	/* Nothing to output if only table packets were received */
+	if(ss->ssdv.packet_id == 0)
 	{
-		if(i == s->packet_mcu_offset)
-		{
-			/* The first MCU in a packet is byte aligned,
-			 * any old bits should be dropped. */
-			s->workbits = s->worklen = 0;
-			
-			/* Abandon the packet if the MCU index is not what it should be. */
-			if(s->mcu_id != s->packet_mcu_id)
-			{
-				fprintf(stderr, "Unexpected MCU ID in packet %d.\n", packet_id);
-				return(SSDV_FEED_ME);
-			}
-		}
-		
-		b = packet[SSDV_PKT_SIZE_HEADER + i];
-		
-		/* Add the new byte to the work area */
-		s->workbits = (s->workbits << 8) | b;
-		s->worklen += 8;
-		
-		/* Process the new data until more needed, or an error occurs */
-		while((r = ssdv_process(s)) == SSDV_OK);
+		ss->state = S_SESSION_DONE;
+		return;
+	}
+	
+	complete = (ss->ssdv.mcu_id >= ss->ssdv.mcu_count);
+	
+	ssdv_dec_get_jpeg(&ss->ssdv, &jpeg, &length);
+	if(d->callback) d->callback(ss, jpeg, length, complete, d->user);
+	
+	/* Keep the key so late or duplicate packets are not
+	 * mistaken for the start of a new image */
+	ss->state = S_SESSION_DONE;
+}
+
+/* Pass a full output buffer on to the demultiplexer's sink */
+static void ssdv_demux_sink(uint8_t *data, size_t length, void *user)
+{
+	ssdv_session_t *ss = (ssdv_session_t *) user;
+	ssdv_demux_t *d = (ssdv_demux_t *) ss->demux;
+	
+	d->sink(ss, data, length, d->user);
+}
+
+/* The order sessions are chosen to be evicted in, lowest first */
+static int ssdv_demux_rank(ssdv_session_t *ss)
+{
+	if(ss->state == S_SESSION_FREE) return(0);
+	if(ss->state == S_SESSION_DONE) return(1);
+	return(2);
+}
+
+static ssdv_session_t *ssdv_demux_session(ssdv_demux_t *d, uint32_t callsign, uint8_t image_id)
+{
+	ssdv_session_t *ss, *r = NULL;
+	int i;
+	
+	for(i = 0; i < d->max_sessions; i++)
+	{
+		ss = &d->sessions[i];
 		
-		if(r == SSDV_BUFFER_FULL)
-		{
-			/* Realloc memory */
-		}
-		else if(r == SSDV_EOI)
+		if(ss->state != S_SESSION_FREE &&
+		   ss->callsign == callsign && ss->image_id == image_id)
 		{
-			/* All done! */
-			return(SSDV_OK);
+			return(ss);
 		}
-		else if(r != SSDV_FEED_ME)
+		
+		/* Prefer a free session, then a finished one, then the least recently used */
+		if(r == NULL || ssdv_demux_rank(ss) < ssdv_demux_rank(r) ||
+		   (ss->state == r->state && ss->last_seen < r->last_seen))
 		{
-			/* An error occured */
-			fprintf(stderr, "ssdv_process() failed: %i\n", r);
-			return(SSDV_ERROR);
+			r = ss;
 		}
 	}
 	
-	/* The next packet to expect... */
-	s->packet_id++;
+	/* Evict the chosen session if it is in use */
+	if(r->state == S_SESSION_ACTIVE) ssdv_demux_output(d, r);
 	
-	return(SSDV_FEED_ME);
+	ssdv_dec_init(&r->ssdv, d->pkt_size);
+	ssdv_dec_set_buffer(&r->ssdv, r->buffer, r->length);
+	if(r->reorder) ssdv_dec_set_reorder_buffer(&r->ssdv, r->reorder, r->reorder_length);
+	if(r->repair) ssdv_dec_set_repair_buffer(&r->ssdv, r->repair, r->repair_length);
+	if(r->huff_tables) ssdv_dec_set_huff_tables(&r->ssdv, r->huff_tables);
+	if(d->sink) ssdv_dec_set_sink(&r->ssdv, ssdv_demux_sink, r);
+	r->state = S_SESSION_ACTIVE;
+	r->callsign = callsign;
+	r->image_id = image_id;
+	decode_callsign(r->callsign_s, callsign);
+	
+	return(r);
 }
 
-char ssdv_dec_get_jpeg(ssdv_t *s, uint8_t **jpeg, size_t *length)
+char ssdv_demux_init(ssdv_demux_t *d, ssdv_session_t *sessions, int max_sessions, uint8_t *buffer, size_t length, int pkt_size, ssdv_image_cb_t callback, void *user)
 {
-	/* Is the image complete? */
-	if(s->mcu_id < s->mcu_count) ssdv_fill_gap(s, s->mcu_count);
+	int i;
 	
-	/* Sync, and final EOI header and return */
-	ssdv_outbits_sync(s);
-	s->out_stuff = 0;
-	ssdv_write_marker(s, J_EOI, 0, 0);
+	if(max_sessions < 1) return(SSDV_ERROR);
 	
-	*jpeg = s->out;
-	*length = (size_t) (s->outp - s->out);
+	memset(d, 0, sizeof(ssdv_demux_t));
+	d->sessions = sessions;
+	d->max_sessions = max_sessions;
+	d->pkt_size = pkt_size;
+	d->callback = callback;
+	d->user = user;
+	
+	/* Share the output buffer equally between the sessions */
+	for(i = 0; i < max_sessions; i++)
+	{
+		memset(&sessions[i], 0, sizeof(ssdv_session_t));
+		sessions[i].buffer = buffer + (length / max_sessions) * i;
+		sessions[i].length = length / max_sessions;
+		sessions[i].demux = d;
+	}
 	
 	return(SSDV_OK);
 }
 
-char ssdv_dec_is_packet(uint8_t *packet, int pkt_size, int *errors)
+char ssdv_demux_set_reorder_buffer(ssdv_demux_t *d, uint8_t *buffer, size_t length)
 {
-	uint8_t pkt[SSDV_PKT_SIZE];
-	uint8_t type;
-	uint16_t pkt_size_payload;
-	uint16_t pkt_size_crcdata;
-	ssdv_packet_info_t p;
-	uint32_t x;
 	int i;
 	
-	/* Testing is destructive, work on a copy */
-	memcpy(pkt, packet, pkt_size);
-	pkt[0] = 0x55;
-	
-	type = SSDV_TYPE_INVALID;
-	
-	if(pkt[1] == 0x66 + SSDV_TYPE_NOFEC)
+	/* Share the reorder buffer equally between the sessions,
+	 * any already decoding start using it now */
+	for(i = 0; i < d->max_sessions; i++)
 	{
-		/* Test for a valid NOFEC packet */
-		pkt_size_payload = pkt_size - SSDV_PKT_SIZE_HEADER - SSDV_PKT_SIZE_CRC;
-		pkt_size_crcdata = SSDV_PKT_SIZE_HEADER + pkt_size_payload - 1;
-		
-		/* No FEC scan */
-		if(errors) *errors = 0;
-		
-		/* Test the checksum */
-		x = crc32(&pkt[1], pkt_size_crcdata);
+		d->sessions[i].reorder = buffer + (length / d->max_sessions) * i;
+		d->sessions[i].reorder_length = length / d->max_sessions;
 		
-		i = 1 + pkt_size_crcdata;
-		if(x == (pkt[i + 3] | (pkt[i + 2] << 8) | (pkt[i + 1] << 16) | (pkt[i] << 24)))
+		if(d->sessions[i].state == S_SESSION_ACTIVE)
 		{
-			/* Valid, set the type and continue */
-			type = SSDV_TYPE_NOFEC;
+			ssdv_dec_set_reorder_buffer(&d->sessions[i].ssdv, d->sessions[i].reorder, d->sessions[i].reorder_length);
 		}
 	}
-	else if(pkt[1] == 0x66 + SSDV_TYPE_NORMAL)
+	
+	return(SSDV_OK);
+}
+
+char ssdv_demux_set_repair_buffer(ssdv_demux_t *d, uint8_t *buffer, size_t length)
+{
+	int i;
+	
+	/* Share the repair buffer equally between the sessions,
+	 * any already decoding start using it now */
+	for(i = 0; i < d->max_sessions; i++)
 	{
-		/* Test for a valid NORMAL packet */
-		pkt_size_payload = pkt_size - SSDV_PKT_SIZE_HEADER - SSDV_PKT_SIZE_CRC - SSDV_PKT_SIZE_RSCODES;
-		pkt_size_crcdata = SSDV_PKT_SIZE_HEADER + pkt_size_payload - 1;
-		
-		/* No FEC scan */
-		if(errors) *errors = 0;
+		d->sessions[i].repair = buffer + (length / d->max_sessions) * i;
+		d->sessions[i].repair_length = length / d->max_sessions;
 		
-		/* Test the checksum */
-		x = crc32(&pkt[1], pkt_size_crcdata);
-		
-		i = 1 + pkt_size_crcdata;
-		if(x == (pkt[i + 3] | (pkt[i + 2] << 8) | (pkt[i + 1] << 16) | (pkt[i] << 24)))
+		if(d->sessions[i].state == S_SESSION_ACTIVE)
 		{
-			/* Valid, set the type and continue */
-			type = SSDV_TYPE_NORMAL;
+			ssdv_dec_set_repair_buffer(&d->sessions[i].ssdv, d->sessions[i].repair, d->sessions[i].repair_length);
 		}
 	}
 	
-	if(type == SSDV_TYPE_INVALID)
+	return(SSDV_OK);
+}
+
+char ssdv_demux_set_huff_tables(ssdv_demux_t *d, ssdv_huff_tables_t *tables)
+{
+	int i;
+	
+	/* One set of tables for each session */
+	for(i = 0; i < d->max_sessions; i++)
 	{
-		/* Test for a valid NORMAL packet with correctable errors */
-		pkt_size_payload = pkt_size - SSDV_PKT_SIZE_HEADER - SSDV_PKT_SIZE_CRC - SSDV_PKT_SIZE_RSCODES;
-		pkt_size_crcdata = SSDV_PKT_SIZE_HEADER + pkt_size_payload - 1;
-		
-		/* Run the reed-solomon decoder */
-		pkt[1] = 0x66 + SSDV_TYPE_NORMAL;
-		i = decode_rs_8(&pkt[1], 0, 0, SSDV_PKT_SIZE - pkt_size);
-		
-		if(i < 0) return(-1); /* Reed-solomon decoder failed */
-		if(errors) *errors = i;
-		
-		/* Test the checksum */
-		x = crc32(&pkt[1], pkt_size_crcdata);
+		d->sessions[i].huff_tables = &tables[i];
+	}
+	
+	return(SSDV_OK);
+}
+
+char ssdv_demux_set_sink(ssdv_demux_t *d, ssdv_chunk_cb_t sink)
+{
+	/* Each session's output buffer is emptied into the sink when full,
+	 * so it only needs to be big enough to make that worthwhile */
+	d->sink = sink;
+	return(SSDV_OK);
+}
+
+char ssdv_demux_set_timeout(ssdv_demux_t *d, uint32_t packets)
+{
+	d->timeout = packets;
+	return(SSDV_OK);
+}
+
+char ssdv_demux_feed(ssdv_demux_t *d, uint8_t *packet)
+{
+	ssdv_session_t *ss;
+	uint32_t callsign;
+	int i;
+	char r;
+	
+	d->packets++;
+	
+	/* Output any images that have not been heard from for a while */
+	for(i = 0; d->timeout && i < d->max_sessions; i++)
+	{
+		ss = &d->sessions[i];
 		
-		i = 1 + pkt_size_crcdata;
-		if(x == (pkt[i + 3] | (pkt[i + 2] << 8) | (pkt[i + 1] << 16) | (pkt[i] << 24)))
+		if(ss->state != S_SESSION_FREE && d->packets - ss->last_seen > d->timeout)
 		{
-			/* Valid, set the type and continue */
-			type = SSDV_TYPE_NORMAL;
+			if(ss->state == S_SESSION_ACTIVE) ssdv_demux_output(d, ss);
+			ss->state = S_SESSION_FREE;
 		}
 	}
 	
-	if(type == SSDV_TYPE_INVALID)
-	{
-		/* All attempts to read the packet have failed */
-		return(-1);
-	}
+	/* Find the decoder for this image, starting a new one if needed */
+	callsign = (packet[2] << 24) | (packet[3] << 16) | (packet[4] << 8) | packet[5];
+	ss = ssdv_demux_session(d, callsign, packet[6]);
 	
-	/* Sanity checks */
-	ssdv_dec_header(&p, pkt);
+	/* Packets for a finished image don't keep it from timing out */
+	if(ss->state == S_SESSION_DONE) return(SSDV_FEED_ME);
 	
-	if(p.type != type) return(-1);
-	if(p.width == 0 || p.height == 0) return(-1);
-	if(p.mcu_id != 0xFFFF)
-	{
-		if(p.mcu_id >= p.mcu_count) return(-1);
-		if(p.mcu_offset >= pkt_size_payload) return(-1);
-	}
+	ss->last_seen = d->packets;
 	
-	/* Appears to be a valid packet! Copy it back */
-	memcpy(packet, pkt, pkt_size);
+	r = ssdv_dec_feed(&ss->ssdv, packet);
 	
-	return(0);
+	/* Reached the end of the image? */
+	if(r == SSDV_OK) ssdv_demux_output(d, ss);
+	
+	return(r);
 }
 
-void ssdv_dec_header(ssdv_packet_info_t *info, uint8_t *packet)
+char ssdv_demux_flush(ssdv_demux_t *d)
 {
-	info->type       = packet[1] - 0x66;
-	info->callsign   = (packet[2] << 24) | (packet[3] << 16) | (packet[4] << 8) | packet[5];
-	decode_callsign(info->callsign_s, info->callsign);
-	info->image_id   = packet[6];
-	info->packet_id  = (packet[7] << 8) | packet[8];
-	info->width      = packet[9] << 4;
-	info->height     = packet[10] << 4;
-	info->eoi        = (packet[11] >> 2) & 1;
-	info->quality    = ((packet[11] >> 3) & 7) ^ 4;
-	info->mcu_mode   = packet[11] & 0x03;
-	info->mcu_offset = packet[12];
-	info->mcu_id     = (packet[13] << 8) | packet[14];
-	info->mcu_count  = packet[9] * packet[10];
-	if(info->mcu_mode == 1 || info->mcu_mode == 2) info->mcu_count *= 2;
-	else if(info->mcu_mode == 3) info->mcu_count *= 4;
+	int i;
+	
+	for(i = 0; i < d->max_sessions; i++)
+	{
+		if(d->sessions[i].state == S_SESSION_ACTIVE)
+		{
+			ssdv_demux_output(d, &d->sessions[i]);
+		}
+		
+		d->sessions[i].state = S_SESSION_FREE;
+	}
+	
+	return(SSDV_OK);
 }
 
 /*****************************************************************************/
-
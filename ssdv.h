@@ -32,25 +32,81 @@ extern "C" {
 #define SSDV_EOI         (4)
 
 /* Packet details */
-#define SSDV_PKT_SIZE         (0x100)
+#define SSDV_PKT_SIZE         (0x100)  /* Default, and the most that fits one RS codeword */
+#define SSDV_PKT_SIZE_MAX     (0x1000)
 #define SSDV_PKT_SIZE_HEADER  (0x0F)
+#define SSDV_PKT_SIZE_HEADER_WIDE (0x10) /* Longer packets, with a 16-bit MCU offset */
 #define SSDV_PKT_SIZE_CRC     (0x04)
-#define SSDV_PKT_SIZE_RSCODES (0x20)
+#define SSDV_PKT_SIZE_RSCODES (0x20) /* Default, see ssdv_enc_set_fec() */
 
 #define TBL_LEN (546) /* Maximum size of the DQT and DHT tables */
 #define HBUFF_LEN (16) /* Extra space for reading marker data */
+#define SSDV_TABLES_LEN (TBL_LEN + 6) /* Maximum size of the tables sent in table packets */
 
 #define SSDV_MAX_CALLSIGN (6) /* Maximum number of characters in a callsign */
 
+#define SSDV_HUFF_LOOKAHEAD (8) /* Bits resolved by the huffman lookup table */
+
 #define SSDV_TYPE_INVALID (0xFF)
 #define SSDV_TYPE_NORMAL  (0x00)
 #define SSDV_TYPE_NOFEC   (0x01)
+#define SSDV_TYPE_TABLES  (0x02) /* Added to the type of a table packet */
+#define SSDV_TYPE_RS      (0x0C) /* Reed-Solomon strength of a normal packet */
+#define SSDV_TYPE_REPAIR  (0x10) /* Added to the type of a repair packet */
+
+#define SSDV_REPAIR_MAX (48) /* Most repair packets sent for a group */
+
+#define SSDV_VALIDATE_PACKETS (64) /* Packets ssdv_dec_is_packets() works on at once */
+
+/* The tables an image can send in table packets */
+#define SSDV_TABLES_DHT (0x01)
+#define SSDV_TABLES_DQT (0x02)
+
+/* Fast huffman decoding table, built from a DHT */
+typedef struct
+{
+	const uint16_t *lookup; /* (width << 8) | symbol for each lookahead,
+	                           0 = no short code, NULL = no lookahead   */
+	int32_t maxcode[18];    /* Largest code of each length, -1 if none  */
+	int32_t valoffset[17];  /* Symbol index offset for each code length */
+	const uint8_t *symbols; /* The symbols in the DHT                   */
+} ssdv_huff_t;
+
+/* Huffman encoding table, built from a DHT */
+typedef struct
+{
+	uint16_t code[256];  /* Code for each symbol                        */
+	uint8_t width[256];  /* Width of each code, 0 = symbol not in table */
+} ssdv_hcode_t;
+
+/* Tables built for DHT tables other than the standard ones, whose tables
+ * are shared. Without them an image's own input tables are decoded without
+ * the lookahead, and it can't be sent or decoded with its own tables */
+typedef struct
+{
+	uint16_t lookup[2][2][1 << SSDV_HUFF_LOOKAHEAD]; /* For each input DHT */
+	ssdv_hcode_t hcode[2][2];                        /* For each output DHT */
+} ssdv_huff_tables_t;
+
+/* Factors for requantising from the input DQT tables to the output */
+typedef struct
+{
+	uint8_t dq[2][64];   /* Output DQT value of each part               */
+	uint16_t mul[2][64]; /* Input DQT value of each part                */
+	uint32_t rcp[2][64]; /* Reciprocal of the output DQT value          */
+	uint8_t same[2];     /* 1 = The tables are equal, nothing to do     */
+} ssdv_rq_t;
+
+/* Receives the decoded JPEG as it is written */
+typedef void (*ssdv_sink_cb_t)(uint8_t *data, size_t length, void *user);
 
 typedef struct
 {
 	/* Packet type configuration */
 	uint8_t type; /* 0 = Normal mode (nom. 224 byte packet + 32 bytes FEC),
 	                 1 = No-FEC mode (nom. 256 byte packet) */
+	uint8_t rs;   /* Reed-Solomon strength bits of the type, SSDV_TYPE_RS */
+	uint16_t pkt_size_header;
 	uint16_t pkt_size_payload;
 	uint16_t pkt_size_crcdata;
 	int pkt_size;
@@ -66,7 +122,10 @@ typedef struct
 	uint16_t mcu_count;
 	uint8_t  quality;   /* JPEG quality level for encoding, 0-7         */
 	uint16_t packet_mcu_id;
-	uint8_t  packet_mcu_offset;
+	uint16_t packet_mcu_offset;
+	uint8_t  tables;    /* Tables sent in table packets, SSDV_TABLES_*  */
+	uint8_t  repair_group; /* Image packets in each group for repair    */
+	uint8_t  repairs;   /* Repair packets for each group, 0 = none      */
 	
 	/* Source buffer */
 	uint8_t *inp;      /* Pointer to next input byte                    */
@@ -82,9 +141,11 @@ typedef struct
 	uint8_t *outp;     /* Pointer to the next output byte               */
 	size_t out_len;    /* Number of output bytes remaining              */
 	char out_stuff;    /* Flag to add stuffing bytes to output          */
+	ssdv_sink_cb_t sink; /* Called with the buffer contents when full   */
+	void *sink_user;
 	
 	/* Output bits */
-	uint32_t outbits;  /* Output bit buffer                             */
+	uint64_t outbits;  /* Output bit buffer                             */
 	uint8_t outlen;    /* Number of bits in the output bit buffer       */
 	
 	/* JPEG decoder state */
@@ -117,16 +178,40 @@ typedef struct
 	uint32_t reset_mcu; /* MCU block to do absolute encoding            */
 	uint32_t next_reset_mcu;
 	char needbits;      /* Number of bits needed to decode integer      */
+	uint64_t empty_mcu; /* Output bits for an MCU with no data          */
+	uint8_t empty_mcu_len; /* 0 = too long to cache                     */
 	
 	/* The input huffman and quantisation tables */
 	uint8_t stbls[TBL_LEN + HBUFF_LEN];
 	uint8_t *sdht[2][2], *sdqt[2];
 	uint16_t stbl_len;
+	const ssdv_huff_t *shuff[2][2]; /* Lookup tables for each input DHT */
+	ssdv_huff_t huff[2][2];  /* Those of input DHTs that aren't standard */
+	ssdv_huff_tables_t *huff_tables; /* Storage for their tables, if set */
 	
 	/* The same for output */
 	uint8_t dtbls[TBL_LEN];
 	uint8_t *ddht[2][2], *ddqt[2];
 	uint16_t dtbl_len;
+	const ssdv_hcode_t *dhcode[2][2]; /* Code tables for each output DHT */
+	ssdv_rq_t rq;               /* Requantising from input to output  */
+	
+	/* Tables received in table packets, for decoding */
+	uint8_t ttbls[SSDV_TABLES_LEN];
+	uint8_t *tdht[2][2], *tdqt[2];
+	uint16_t ttbl_len;      /* 0 = No tables being received            */
+	uint16_t ttbl_missing;  /* Number of table packets still to come   */
+	uint8_t ttbl_have[(SSDV_TABLES_LEN + 7) / 8]; /* Packets received  */
+	uint32_t ttbl_callsign;
+	uint8_t ttbl_image_id;
+	
+	/* Packets received ahead of the one expected */
+	uint8_t *reorder;   /* Buffer of reorder_slots packets              */
+	int reorder_slots;  /* Number of packets held, 0 = no reordering    */
+	
+	/* The repair packets of a group, then the recent packets to repair */
+	uint8_t *repair;    /* Buffer of SSDV_REPAIR_MAX + repair_slots packets */
+	int repair_slots;   /* Number of recent packets held, 0 = no repair */
 	
 } ssdv_t;
 
@@ -140,26 +225,165 @@ typedef struct {
 	uint16_t height;
 	uint8_t  eoi;
 	uint8_t  quality;
+	uint8_t  tables;
 	uint16_t mcu_mode;
-	uint8_t  mcu_offset;
+	uint16_t mcu_offset;
 	uint16_t mcu_id;
 	uint16_t mcu_count;
 } ssdv_packet_info_t;
 
+/* An image read ahead of encoding, so its packets can be made in any order */
+typedef struct {
+	int16_t *coef[3];   /* Coefficients of each component, 64 for each block.
+	                     * ssdv_enc_plan_rows() requantises the AC values */
+	uint8_t *ends[3];   /* The ZRL and EOB codes that end each block    */
+	uint16_t *bits;     /* Length of each MCU in bits                   */
+	uint16_t *abits;    /* The same, beginning with absolute DC values  */
+	uint8_t *tail;      /* Bits output for the last code of each MCU    */
+	int rows;           /* Number of MCU rows in the image              */
+	int row_mcus;       /* Number of MCUs in each row                   */
+	
+	/* Set by ssdv_enc_plan_layout() */
+	uint32_t *pos;      /* Where each MCU begins in the packet data, in bits */
+	uint8_t *reset;     /* Set for the MCU that begins each packet      */
+	uint32_t length;    /* Total length of the packet data in bits      */
+	int packets;        /* Number of packets in the image               */
+} ssdv_plan_t;
+
+/* A run of packet data starting with an MCU, for decoding in parallel */
+typedef struct {
+	uint8_t *packets;   /* First packet of the segment                  */
+	int count;          /* Number of packets holding the segment data   */
+	uint16_t offset;    /* Where the first MCU begins in the first packet */
+	uint16_t end;       /* Where the data ends in the last packet       */
+	uint16_t mcu_id;    /* First MCU in the segment                     */
+	uint16_t mcu_end;   /* MCU that begins after the segment            */
+	
+	/* Output, bit aligned and without stuffing */
+	uint8_t *out;
+	size_t out_length;
+	size_t bits;        /* Total bits output                            */
+	uint8_t seams;      /* Number of DC codes in the first MCU found    */
+	size_t dc_pos[3];   /* Where they are in the output, Y, Cb and Cr   */
+	uint8_t dc_len[3];  /* Their length in bits                         */
+	int dc_value[3];    /* And their absolute values                    */
+	uint16_t mcu_next;  /* MCU reached at the end of the data           */
+	int dc[3];          /* DC values at the end of the segment          */
+	char status;        /* SSDV_OK if the segment was decoded           */
+} ssdv_segment_t;
+
+/* A decoder for one image in a multiplexed stream */
+typedef struct {
+	ssdv_t ssdv;
+	enum {
+		S_SESSION_FREE = 0,
+		S_SESSION_ACTIVE,
+		S_SESSION_DONE,   /* Image output, drop any further packets */
+	} state;
+	uint32_t callsign;
+	char callsign_s[SSDV_MAX_CALLSIGN + 1];
+	uint8_t image_id;
+	uint32_t last_seen; /* Packet count when this session was last fed */
+	uint8_t *buffer;    /* JPEG output buffer for this image            */
+	size_t length;
+	uint8_t *reorder;   /* Reorder buffer for this image, if any        */
+	size_t reorder_length;
+	uint8_t *repair;    /* Repair buffer for this image, if any         */
+	size_t repair_length;
+	ssdv_huff_tables_t *huff_tables; /* Huffman tables for this image, if any */
+	void *demux;        /* The demultiplexer this session belongs to    */
+} ssdv_session_t;
+
+/* Callback for each image decoded by the demultiplexer. 'complete' is
+ * set if the end of the image was reached, otherwise the image has
+ * been padded out because it was evicted or flushed */
+typedef void (*ssdv_image_cb_t)(ssdv_session_t *ss, uint8_t *jpeg, size_t length, char complete, void *user);
+
+/* Callback for each piece of an image as it is decoded, when the
+ * demultiplexer has a sink. The image callback then marks its end,
+ * with nothing left over in 'jpeg' */
+typedef void (*ssdv_chunk_cb_t)(ssdv_session_t *ss, uint8_t *data, size_t length, void *user);
+
+typedef struct {
+	ssdv_session_t *sessions;
+	int max_sessions;
+	int pkt_size;
+	uint32_t packets;   /* Number of packets fed                        */
+	uint32_t timeout;   /* Evict sessions idle for this many packets    */
+	ssdv_image_cb_t callback;
+	ssdv_chunk_cb_t sink;
+	void *user;
+} ssdv_demux_t;
+
 /* Encoding */
 extern char ssdv_enc_init(ssdv_t *s, uint8_t type, char *callsign, uint8_t image_id, int8_t quality, int pkt_size);
+extern char ssdv_enc_set_quality(ssdv_t *s, int8_t quality);
+extern char ssdv_enc_set_source_dqt(ssdv_t *s);
+extern char ssdv_enc_set_fec(ssdv_t *s, int rs_roots);
+extern char ssdv_enc_set_repair(ssdv_t *s, int group, int repairs);
 extern char ssdv_enc_set_buffer(ssdv_t *s, uint8_t *buffer);
+extern char ssdv_enc_set_huff_tables(ssdv_t *s, ssdv_huff_tables_t *tables);
 extern char ssdv_enc_get_packet(ssdv_t *s);
 extern char ssdv_enc_feed(ssdv_t *s, uint8_t *buffer, size_t length);
+extern char ssdv_enc_image(ssdv_t *s, uint8_t *jpeg, size_t length, uint8_t *packets, int max_packets, int *count);
+extern int ssdv_enc_table_packets(ssdv_t *s);
+extern char ssdv_enc_table_packet(ssdv_t *s, int index, uint8_t *packet);
+extern char ssdv_enc_repair_packets(ssdv_t *s, uint8_t *packets, int count, uint8_t *repair);
+
+/* Encoding a whole image in parallel */
+extern size_t ssdv_enc_plan_size(ssdv_t *s, uint8_t *jpeg, size_t length);
+extern char ssdv_enc_plan(ssdv_t *s, ssdv_plan_t *plan, uint8_t *buffer, size_t length);
+extern char ssdv_enc_plan_estimate(ssdv_t *s, ssdv_plan_t *plan, int packets[8]);
+extern char ssdv_enc_plan_rows(ssdv_t *s, ssdv_plan_t *plan, int first, int count);
+extern char ssdv_enc_plan_layout(ssdv_t *s, ssdv_plan_t *plan);
+extern char ssdv_enc_plan_optimise(ssdv_t *s, ssdv_plan_t *plan, int repeat);
+extern char ssdv_enc_plan_packets(ssdv_t *s, ssdv_plan_t *plan, int first, int count, uint8_t *packets);
 
 /* Decoding */
 extern char ssdv_dec_init(ssdv_t *s, int pkt_size);
 extern char ssdv_dec_set_buffer(ssdv_t *s, uint8_t *buffer, size_t length);
+extern char ssdv_dec_set_reorder_buffer(ssdv_t *s, uint8_t *buffer, size_t length);
+extern char ssdv_dec_set_repair_buffer(ssdv_t *s, uint8_t *buffer, size_t length);
+extern char ssdv_dec_set_huff_tables(ssdv_t *s, ssdv_huff_tables_t *tables);
+extern char ssdv_dec_set_sink(ssdv_t *s, ssdv_sink_cb_t sink, void *user);
+extern size_t ssdv_dec_max_jpeg_size(ssdv_t *s, uint8_t *packet);
 extern char ssdv_dec_feed(ssdv_t *s, uint8_t *packet);
 extern char ssdv_dec_get_jpeg(ssdv_t *s, uint8_t **jpeg, size_t *length);
+extern char ssdv_dec_snapshot(ssdv_t *s, uint8_t **jpeg, size_t *length);
 
 extern char ssdv_dec_is_packet(uint8_t *packet, int pkt_size, int *errors);
+extern char ssdv_dec_is_candidate(uint8_t *packet); /* Could a packet begin here, without testing it */
+extern int ssdv_dec_repair_group(uint8_t *packet, int *repairs); /* Packets repaired by a repair packet, or 0 */
+extern char ssdv_dec_find_packet(uint8_t *buffer, size_t length, int pkt_size, size_t *offset, int *errors);
 extern void ssdv_dec_header(ssdv_packet_info_t *info, uint8_t *packet);
+extern void ssdv_dec_header_n(ssdv_packet_info_t *info, uint8_t *packet, int pkt_size); /* For packets longer than SSDV_PKT_SIZE */
+
+/* Validate up to 'count' packets in a row in place, as ssdv_dec_is_packet()
+ * would each one, stopping at the first that isn't valid. errors[] is set
+ * to the number of errors corrected in each if not NULL. Returns the number
+ * of valid packets */
+extern int ssdv_dec_is_packets(uint8_t *packets, int count, int pkt_size, int *errors);
+
+/* Finding packets with the confidence of each byte from the demodulator,
+ * 0 for an erased byte up to 255. The least confident bytes are erased
+ * when a packet has too many errors to correct otherwise */
+extern char ssdv_dec_is_packet_soft(uint8_t *packet, int pkt_size, uint8_t *confidence, int *errors);
+extern char ssdv_dec_find_packet_soft(uint8_t *buffer, uint8_t *confidence, size_t length, int pkt_size, size_t *offset, int *errors);
+
+/* Decoding a whole image in parallel */
+extern char ssdv_dec_split(ssdv_t *s, uint8_t *packets, int count, ssdv_segment_t *segments, int *nsegments, uint8_t *buffer, size_t length);
+extern char ssdv_dec_segment(ssdv_t *s, ssdv_segment_t *seg);
+extern char ssdv_dec_stitch(ssdv_t *s, ssdv_segment_t *segments, int nsegments);
+
+/* Decoding multiple images */
+extern char ssdv_demux_init(ssdv_demux_t *d, ssdv_session_t *sessions, int max_sessions, uint8_t *buffer, size_t length, int pkt_size, ssdv_image_cb_t callback, void *user);
+extern char ssdv_demux_set_reorder_buffer(ssdv_demux_t *d, uint8_t *buffer, size_t length);
+extern char ssdv_demux_set_repair_buffer(ssdv_demux_t *d, uint8_t *buffer, size_t length);
+extern char ssdv_demux_set_huff_tables(ssdv_demux_t *d, ssdv_huff_tables_t *tables);
+extern char ssdv_demux_set_sink(ssdv_demux_t *d, ssdv_chunk_cb_t sink);
+extern char ssdv_demux_set_timeout(ssdv_demux_t *d, uint32_t packets);
+extern char ssdv_demux_feed(ssdv_demux_t *d, uint8_t *packet);
+extern char ssdv_demux_flush(ssdv_demux_t *d);
 
 #ifdef __cplusplus
 }